@@ -0,0 +1,1560 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <map>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include "s21_container.h"
+
+// Бенчмарки контейнеров: время и число вызовов operator new.
+// Запуск: ./bench [имя_раздела ...], без аргументов выполняются все разделы.
+
+// operator new/delete ниже заменены на malloc/free; после встраивания GCC
+// принимает пару new + free за ошибку
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// счётчики атомарные: в разделах с потоками operator new зовут несколько
+// потоков сразу
+static std::atomic<std::size_t> g_allocations{0};
+static std::atomic<std::size_t> g_bytes{0};
+static volatile long long g_sink = 0;
+
+void *operator new(std::size_t size) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  g_bytes.fetch_add(size, std::memory_order_relaxed);
+  if (void *ptr = std::malloc(size ? size : 1))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, std::align_val_t align) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  g_bytes.fetch_add(size, std::memory_order_relaxed);
+  std::size_t alignment = static_cast<std::size_t>(align);
+  std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+  if (void *ptr = std::aligned_alloc(alignment, rounded ? rounded : alignment))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+struct Result {
+  double ms;
+  std::size_t allocations;
+};
+
+template <typename F> Result measure(F &&body) {
+  std::size_t before = g_allocations;
+  auto start = std::chrono::steady_clock::now();
+  body();
+  auto stop = std::chrono::steady_clock::now();
+  return {std::chrono::duration<double, std::milli>(stop - start).count(),
+          g_allocations - before};
+}
+
+void report(const char *name, const Result &result) {
+  std::printf("  %-44s %10.2f ms %12zu allocs\n", name, result.ms,
+              result.allocations);
+}
+
+bool selected(int argc, char **argv, const char *section) {
+  if (argc < 2)
+    return true;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], section) == 0)
+      return true;
+  }
+  return false;
+}
+
+// очередь поверх списка: окно из 64 элементов, push_back + pop_front
+template <typename L> void queue_workload(L &list, int operations) {
+  for (int i = 0; i < operations; ++i) {
+    list.push_back(i);
+    if (list.size() > 64) {
+      g_sink = g_sink + list.front();
+      list.pop_front();
+    }
+  }
+}
+
+void bench_list_pool() {
+  const int n = 1000000;
+  std::printf("list_pool: %d push_back/pop_front, 1e6 push_back + clear\n",
+              n);
+  report("std::list queue", measure([&] {
+           std::list<int> list;
+           queue_workload(list, n);
+         }));
+  report("s21::List queue", measure([&] {
+           s21::List<int> list;
+           queue_workload(list, n);
+         }));
+  report("std::list fill + clear", measure([&] {
+           std::list<int> list;
+           for (int i = 0; i < n; ++i)
+             list.push_back(i);
+           list.clear();
+         }));
+  report("s21::List fill + clear", measure([&] {
+           s21::List<int> list;
+           for (int i = 0; i < n; ++i)
+             list.push_back(i);
+           list.clear();
+         }));
+  report("s21::List reserve_nodes + fill + clear", measure([&] {
+           s21::List<int> list;
+           list.reserve_nodes(n);
+           for (int i = 0; i < n; ++i)
+             list.push_back(i);
+           list.clear();
+         }));
+}
+
+// узел List до перехода на сторожа: концы цепочки — nullptr
+struct LegacyNode {
+  int data;
+  LegacyNode *next;
+  LegacyNode *prev;
+};
+
+// рекурсивная сортировка List до перехода на слияние снизу вверх
+template <typename Node> Node *legacy_merge(Node *left, Node *right) {
+  if (!left)
+    return right;
+  if (!right)
+    return left;
+  if (left->data < right->data) {
+    left->next = legacy_merge(left->next, right);
+    left->next->prev = left;
+    left->prev = nullptr;
+    return left;
+  }
+  right->next = legacy_merge(left, right->next);
+  right->next->prev = right;
+  right->prev = nullptr;
+  return right;
+}
+
+template <typename Node> Node *legacy_merge_sort(Node *node) {
+  if (!node || !node->next)
+    return node;
+  Node *slow = node;
+  Node *fast = node->next;
+  while (fast && fast->next) {
+    slow = slow->next;
+    fast = fast->next->next;
+  }
+  Node *half = slow->next;
+  slow->next = nullptr;
+  return legacy_merge(legacy_merge_sort(node), legacy_merge_sort(half));
+}
+
+unsigned next_random(unsigned &seed) {
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 1;
+}
+
+void bench_list_sort() {
+  std::printf("list_sort: random ints\n");
+  char name[64];
+  for (int n = 10000; n <= 10000000; n *= 10) {
+    unsigned seed = 42;
+    std::list<int> std_list;
+    s21::List<int> list;
+    for (int i = 0; i < n; ++i) {
+      int value = static_cast<int>(next_random(seed));
+      std_list.push_back(value);
+      list.push_back(value);
+    }
+    if (n <= 100000) {
+      // глубина рекурсии старой версии растёт линейно, дальше стек кончается
+      std::unique_ptr<LegacyNode[]> legacy(new LegacyNode[n]);
+      int i = 0;
+      for (int value : list) {
+        legacy[i] = {value, i + 1 < n ? &legacy[i + 1] : nullptr,
+                     i ? &legacy[i - 1] : nullptr};
+        ++i;
+      }
+      std::snprintf(name, sizeof(name), "legacy recursive sort n=%d", n);
+      report(name, measure([&] {
+               LegacyNode *head = legacy_merge_sort(&legacy[0]);
+               g_sink = g_sink + head->data;
+             }));
+    }
+    std::snprintf(name, sizeof(name), "s21::List::sort n=%d", n);
+    report(name, measure([&] { list.sort(); }));
+    std::snprintf(name, sizeof(name), "std::list::sort n=%d", n);
+    report(name, measure([&] { std_list.sort(); }));
+    g_sink = g_sink + list.front() + std_list.front();
+  }
+}
+
+// слияние List до перехода на перецепление: копия каждого элемента
+template <typename L> void legacy_list_merge(L &list, L &other) {
+  auto it1 = list.begin();
+  auto it2 = other.begin();
+  while (it1 != list.end() && it2 != other.end()) {
+    if (*it2 < *it1) {
+      list.insert(it1, *it2);
+      ++it2;
+    } else {
+      ++it1;
+    }
+  }
+  while (it2 != other.end()) {
+    list.push_back(*it2);
+    ++it2;
+  }
+  other.clear();
+}
+
+void bench_list_merge() {
+  const int n = 1000000;
+  std::printf("list_merge: two sorted lists of %d ints\n", n);
+  auto fill = [&](auto &a, auto &b) {
+    for (int i = 0; i < n; ++i) {
+      a.push_back(2 * i);
+      b.push_back(2 * i + 1);
+    }
+  };
+  {
+    s21::List<int> a, b;
+    fill(a, b);
+    report("legacy copying merge", measure([&] { legacy_list_merge(a, b); }));
+  }
+  {
+    s21::List<int> a, b;
+    fill(a, b);
+    report("s21::List::merge", measure([&] { a.merge(b); }));
+  }
+  {
+    std::list<int> a, b;
+    fill(a, b);
+    report("std::list::merge", measure([&] { a.merge(b); }));
+  }
+}
+
+template <typename L> void unrolled_workload(const char *name) {
+  const int n = 1000000;
+  const int inserts = 100000;
+  char label[64];
+
+  std::size_t bytes = g_bytes;
+  L list;
+  for (int i = 0; i < n; ++i)
+    list.push_back(i);
+  std::printf("  %-44s %10.2f bytes/element\n", name,
+              static_cast<double>(g_bytes - bytes) / n);
+
+  std::snprintf(label, sizeof(label), "%s iterate x10", name);
+  report(label, measure([&] {
+           long long sum = 0;
+           for (int round = 0; round < 10; ++round) {
+             for (auto it = list.begin(); it != list.end(); ++it)
+               sum += *it;
+           }
+           g_sink = g_sink + sum;
+         }));
+
+  auto middle = list.begin();
+  for (int i = 0; i < n / 2; ++i)
+    ++middle;
+  std::snprintf(label, sizeof(label), "%s insert mid x%d", name, inserts);
+  report(label, measure([&] {
+           for (int i = 0; i < inserts; ++i)
+             middle = list.insert(middle, i);
+         }));
+}
+
+void bench_unrolled_list() {
+  std::printf("unrolled_list: 1e6 ints\n");
+  unrolled_workload<s21::List<int>>("s21::List");
+  unrolled_workload<s21::unrolled_list<int>>("unrolled_list<int, 256>");
+  unrolled_workload<s21::unrolled_list<int, 1024>>("unrolled_list<int, 1024>");
+}
+
+struct Connection {
+  int id = 0;
+  char payload[56] = {};
+  s21::intrusive_list_hook hook;
+};
+
+void bench_intrusive_list() {
+  const int pool_size = 4096;
+  const int rounds = 1000;
+  std::printf("intrusive_list: %d objects cycled %d times\n", pool_size,
+              rounds);
+  static Connection connections[pool_size];
+  for (int i = 0; i < pool_size; ++i)
+    connections[i].id = i;
+
+  report("s21::List<Connection> push_back/pop_front", measure([&] {
+           s21::List<Connection> list;
+           for (int round = 0; round < rounds; ++round) {
+             for (auto &connection : connections)
+               list.push_back(connection);
+             while (!list.empty()) {
+               g_sink = g_sink + list.front().id;
+               list.pop_front();
+             }
+           }
+         }));
+  report("intrusive_list push_back/pop_front", measure([&] {
+           s21::intrusive_list<Connection, &Connection::hook> list;
+           for (int round = 0; round < rounds; ++round) {
+             for (auto &connection : connections)
+               list.push_back(connection);
+             while (!list.empty()) {
+               g_sink = g_sink + list.front().id;
+               list.pop_front();
+             }
+           }
+         }));
+  report("intrusive_list push_back/erase(value)", measure([&] {
+           s21::intrusive_list<Connection, &Connection::hook> list;
+           for (int round = 0; round < rounds; ++round) {
+             for (auto &connection : connections)
+               list.push_back(connection);
+             for (int i = 0; i < pool_size; i += 2)
+               list.erase(connections[i]);
+             for (int i = 1; i < pool_size; i += 2)
+               list.erase(connections[i]);
+           }
+         }));
+}
+
+void bench_compact_list() {
+  const int count = 1000000;
+  const int copies = 20;
+  std::printf("compact_list: %d ints, %d copies\n", count, copies);
+  std::printf("  bytes per element: s21::List %zu, compact_list %zu\n",
+              s21::List<int>::node_size(), s21::compact_list<int>::slot_size());
+
+  s21::List<int> list;
+  s21::compact_list<int> compact;
+  report("s21::List push_back", measure([&] {
+           for (int i = 0; i < count; ++i)
+             list.push_back(i);
+         }));
+  report("compact_list push_back", measure([&] {
+           for (int i = 0; i < count; ++i)
+             compact.push_back(i);
+         }));
+  report("s21::List iterate x10", measure([&] {
+           for (int round = 0; round < 10; ++round) {
+             long long sum = 0;
+             for (int value : list)
+               sum += value;
+             g_sink = g_sink + sum;
+           }
+         }));
+  report("compact_list iterate x10", measure([&] {
+           for (int round = 0; round < 10; ++round) {
+             long long sum = 0;
+             for (int value : compact)
+               sum += value;
+             g_sink = g_sink + sum;
+           }
+         }));
+  report("s21::List copy", measure([&] {
+           for (int round = 0; round < copies; ++round) {
+             s21::List<int> copy(list);
+             g_sink = g_sink + copy.back();
+           }
+         }));
+  report("compact_list copy (memcpy)", measure([&] {
+           for (int round = 0; round < copies; ++round) {
+             s21::compact_list<int> copy(compact);
+             g_sink = g_sink + copy.back();
+           }
+         }));
+  report("s21::List queue", measure([&] {
+           s21::List<int> queue;
+           queue_workload(queue, count * 10);
+         }));
+  report("compact_list queue", measure([&] {
+           s21::compact_list<int> queue;
+           queue_workload(queue, count * 10);
+         }));
+}
+
+// List до перехода на сторожа: тот же общий пул узлов, но каждая операция
+// разбирает случаи пустого списка, головы и хвоста
+struct LegacyList {
+  using pool_type = s21::NodePool<LegacyNode>;
+  LegacyNode *head = nullptr;
+  LegacyNode *tail = nullptr;
+  std::size_t length = 0;
+  std::shared_ptr<pool_type> pool = std::make_shared<pool_type>();
+
+  LegacyNode *create(int value) {
+    LegacyNode *node = pool_type::resolve(pool).allocate();
+    *node = {value, nullptr, nullptr};
+    return node;
+  }
+  void push_back(int value) {
+    LegacyNode *node = create(value);
+    if (tail) {
+      tail->next = node;
+      node->prev = tail;
+      tail = node;
+    } else {
+      head = tail = node;
+    }
+    ++length;
+  }
+  void push_front(int value) {
+    LegacyNode *node = create(value);
+    if (head) {
+      head->prev = node;
+      node->next = head;
+      head = node;
+    } else {
+      head = tail = node;
+    }
+    ++length;
+  }
+  void insert(LegacyNode *pos, int value) {
+    if (!pos)
+      return push_back(value);
+    LegacyNode *node = create(value);
+    node->next = pos;
+    node->prev = pos->prev;
+    if (pos->prev)
+      pos->prev->next = node;
+    else
+      head = node;
+    pos->prev = node;
+    ++length;
+  }
+  void erase(LegacyNode *node) {
+    if (node->prev)
+      node->prev->next = node->next;
+    if (node->next)
+      node->next->prev = node->prev;
+    if (node == head)
+      head = node->next;
+    if (node == tail)
+      tail = node->prev;
+    pool_type::resolve(pool).deallocate(node);
+    --length;
+  }
+};
+
+// случайная смесь операций на концах списка из 0..3 элементов: у старой
+// версии ветви пустого списка, головы и хвоста выбираются непредсказуемо
+template <typename L, typename Ops>
+void edge_workload(L &list, int operations, Ops ops) {
+  unsigned seed = 7;
+  for (int i = 0; i < operations; ++i) {
+    unsigned op = next_random(seed) % 8;
+    if (op >= 4 && list.length == 0)
+      op -= 4;
+    if (list.length > 2)
+      op |= 4;
+    ops(list, op, i);
+  }
+  g_sink = g_sink + static_cast<long long>(list.length);
+}
+
+void bench_list_sentinel() {
+  const int n = 20000000;
+  std::printf("list_sentinel: %d random push/pop/insert/erase at the ends\n",
+              n);
+  report("legacy head/tail List", measure([&] {
+           LegacyList list;
+           edge_workload(list, n, [](LegacyList &l, unsigned op, int value) {
+             switch (op) {
+             case 0: l.push_back(value); break;
+             case 1: l.push_front(value); break;
+             case 2: l.insert(l.head, value); break;
+             case 3: l.insert(nullptr, value); break;
+             case 4:
+             case 6: l.erase(l.head); break;
+             default: l.erase(l.tail); break;
+             }
+           });
+         }));
+  report("s21::List with sentinel", measure([&] {
+           s21::List<int> list;
+           edge_workload(list, n, [](s21::List<int> &l, unsigned op,
+                                     int value) {
+             switch (op) {
+             case 0: l.push_back(value); break;
+             case 1: l.push_front(value); break;
+             case 2: l.insert(l.begin(), value); break;
+             case 3: l.insert(l.end(), value); break;
+             case 4: l.pop_front(); break;
+             case 5: l.pop_back(); break;
+             case 6: l.erase(l.begin()); break;
+             default: l.erase(--l.end()); break;
+             }
+           });
+         }));
+}
+
+void bench_erase_if() {
+  const int vector_n = 50000;
+  const int list_n = 1000000;
+  std::printf("erase_if: drop even values, vector %d, List %d\n", vector_n,
+              list_n);
+  auto even = [](int value) { return value % 2 == 0; };
+  s21::vector<int> vector1;
+  vector1.reserve(vector_n);
+  for (int i = 0; i < vector_n; ++i)
+    vector1.push_back(i);
+  s21::vector<int> vector2(vector1);
+  report("s21::vector erase loop", measure([&] {
+           for (auto it = vector1.begin(); it != vector1.end();) {
+             if (even(*it))
+               vector1.erase(it);
+             else
+               ++it;
+           }
+         }));
+  report("s21::vector erase_if", measure([&] {
+           g_sink = g_sink + s21::erase_if(vector2, even);
+         }));
+
+  s21::List<int> list1;
+  s21::List<int> list2;
+  for (int i = 0; i < list_n; ++i) {
+    list1.push_back(i);
+    list2.push_back(i);
+  }
+  report("s21::List erase loop", measure([&] {
+           for (auto it = list1.begin(); it != list1.end();) {
+             auto next = it;
+             ++next;
+             if (even(*it))
+               list1.erase(it);
+             it = next;
+           }
+         }));
+  report("s21::List erase_if", measure([&] {
+           g_sink = g_sink + s21::erase_if(list2, even);
+         }));
+  g_sink = g_sink + vector1.size() + vector2.size() + list1.size() +
+           list2.size();
+}
+
+// ключи с распределением Ципфа: ранг k выпадает с весом 1 / k^s
+class Zipf {
+public:
+  Zipf(int n, double s) : cdf_(n) {
+    double sum = 0;
+    for (int k = 0; k < n; ++k)
+      cdf_[k] = sum += 1.0 / std::pow(k + 1, s);
+    for (double &value : cdf_)
+      value /= sum;
+  }
+  int operator()(unsigned &seed) const {
+    double u = next_random(seed) / 2147483648.0;
+    return static_cast<int>(std::lower_bound(cdf_.begin(), cdf_.end(), u) -
+                            cdf_.begin());
+  }
+
+private:
+  s21::vector<double> cdf_;
+};
+
+// LRU на List + Map, как его собирали до lru_cache: поиск по дереву,
+// перестановка в начало — копия записи и новый узел
+class LegacyLru {
+public:
+  explicit LegacyLru(std::size_t capacity) : capacity_(capacity) {}
+  long long *get(int key) {
+    auto *node = index_.find(key);
+    if (!node)
+      return nullptr;
+    auto it = node->data.second;
+    std::pair<int, long long> entry = *it;
+    order_.erase(it);
+    order_.push_front(entry);
+    node->data.second = order_.begin();
+    return &order_.front().second;
+  }
+  void put(int key, long long value) {
+    if (order_.size() == capacity_) {
+      index_.erase(typename Index::iterator(index_.find(order_.back().first)));
+      order_.pop_back();
+    }
+    order_.push_front({key, value});
+    index_.insert({key, order_.begin()});
+  }
+
+private:
+  using Order = s21::List<std::pair<int, long long>>;
+  using Index = s21::Map<int, Order::Iterator>;
+  std::size_t capacity_;
+  Order order_;
+  Index index_;
+};
+
+template <typename Cache> void zipf_workload(Cache &cache, const Zipf &zipf,
+                                             int operations) {
+  unsigned seed = 99;
+  for (int i = 0; i < operations; ++i) {
+    int key = zipf(seed);
+    if (long long *value = cache.get(key))
+      g_sink = g_sink + *value;
+    else
+      cache.put(key, key);
+  }
+}
+
+void bench_lru_cache() {
+  const int keys = 100000;
+  const int capacity = 10000;
+  const int operations = 2000000;
+  std::printf("lru_cache: %d Zipf(0.99) lookups over %d keys, capacity %d\n",
+              operations, keys, capacity);
+  Zipf zipf(keys, 0.99);
+  report("List + Map LRU", measure([&] {
+           LegacyLru cache(capacity);
+           zipf_workload(cache, zipf, operations);
+         }));
+  s21::lru_cache<int, long long> cache(capacity);
+  report("s21::lru_cache", measure([&] {
+           zipf_workload(cache, zipf, operations);
+         }));
+  std::printf("  hit ratio %.3f, evictions %zu\n",
+              static_cast<double>(cache.hits()) /
+                  static_cast<double>(cache.hits() + cache.misses()),
+              cache.evictions());
+}
+
+void bench_insert_many() {
+  const int lists = 200000;
+  std::printf("insert_many: %d fresh lists of 8 ints, then 8 ints into the "
+              "middle of a long list %d times\n",
+              lists, lists);
+  report("s21::List 8 x push_back", measure([&] {
+           for (int i = 0; i < lists; ++i) {
+             s21::List<int> list;
+             for (int value = 0; value < 8; ++value)
+               list.push_back(value);
+             g_sink = g_sink + list.back();
+           }
+         }));
+  report("s21::List insert_many_back", measure([&] {
+           for (int i = 0; i < lists; ++i) {
+             s21::List<int> list;
+             list.insert_many_back(0, 1, 2, 3, 4, 5, 6, 7);
+             g_sink = g_sink + list.back();
+           }
+         }));
+  s21::List<int> long_list1 = {0, 1};
+  s21::List<int> long_list2 = {0, 1};
+  report("s21::List 8 x insert", measure([&] {
+           auto pos = --long_list1.end();
+           for (int i = 0; i < lists; ++i) {
+             for (int value = 0; value < 8; ++value)
+               long_list1.insert(pos, value);
+           }
+         }));
+  report("s21::List insert_many", measure([&] {
+           auto pos = --long_list2.end();
+           for (int i = 0; i < lists; ++i)
+             long_list2.insert_many(pos, 0, 1, 2, 3, 4, 5, 6, 7);
+         }));
+  g_sink = g_sink + long_list1.size() + long_list2.size();
+}
+
+// дерево поиска Map до балансировки: на возрастающих ключах это цепочка
+struct LegacyTreeNode {
+  int key;
+  LegacyTreeNode *left;
+  LegacyTreeNode *right;
+};
+
+LegacyTreeNode *legacy_tree_insert(LegacyTreeNode *root, int key,
+                                   LegacyTreeNode *node) {
+  *node = {key, nullptr, nullptr};
+  if (!root)
+    return node;
+  LegacyTreeNode *current = root;
+  while (true) {
+    LegacyTreeNode *&next = key < current->key ? current->left : current->right;
+    if (!next) {
+      next = node;
+      return root;
+    }
+    current = next;
+  }
+}
+
+void bench_map_sorted_insert() {
+  const int legacy_n = 20000;
+  const int n = 1000000;
+  std::printf("map_sorted_insert: monotonically increasing keys\n");
+  std::unique_ptr<LegacyTreeNode[]> legacy(new LegacyTreeNode[legacy_n]);
+  char name[64];
+  std::snprintf(name, sizeof(name), "unbalanced tree insert n=%d", legacy_n);
+  Result unbalanced = measure([&] {
+    LegacyTreeNode *root = nullptr;
+    for (int i = 0; i < legacy_n; ++i)
+      root = legacy_tree_insert(root, i, &legacy[i]);
+    g_sink = g_sink + root->key;
+  });
+  report(name, unbalanced);
+  double scale = static_cast<double>(n) / legacy_n;
+  std::printf("  (quadratic: n=%d would take ~%.0f s)\n", n,
+              unbalanced.ms * scale * scale / 1000);
+  s21::Map<int, int> map;
+  std::map<int, int> std_map;
+  std::snprintf(name, sizeof(name), "s21::Map insert n=%d", n);
+  report(name, measure([&] {
+           for (int i = 0; i < n; ++i)
+             map.insert({i, i});
+         }));
+  std::snprintf(name, sizeof(name), "std::map insert n=%d", n);
+  report(name, measure([&] {
+           for (int i = 0; i < n; ++i)
+             std_map.insert({i, i});
+         }));
+  report("s21::Map at, all keys", measure([&] {
+           long long sum = 0;
+           for (int i = 0; i < n; ++i)
+             sum += map.at(i);
+           g_sink = g_sink + sum;
+         }));
+  report("std::map at, all keys", measure([&] {
+           long long sum = 0;
+           for (int i = 0; i < n; ++i)
+             sum += std_map.at(i);
+           g_sink = g_sink + sum;
+         }));
+}
+
+void bench_map_string_lookup() {
+  const int n = 100000;
+  const int lookups = 1000000;
+  std::printf("map_string_lookup: %d lookups by const char* in %d keys\n",
+              lookups, n);
+  s21::vector<std::string> keys(n);
+  s21::Map<std::string, int> map;
+  s21::Map<std::string, int, std::less<>> transparent;
+  char buffer[32];
+  for (int i = 0; i < n; ++i) {
+    std::snprintf(buffer, sizeof(buffer), "session-key-%08d", i);
+    keys[i] = buffer;
+    map.insert({keys[i], i});
+    transparent.insert({keys[i], i});
+  }
+  report("Map<string> at(const char *)", measure([&] {
+           unsigned seed = 5;
+           for (int i = 0; i < lookups; ++i) {
+             const char *key = keys[next_random(seed) % n].c_str();
+             g_sink = g_sink + map.at(key);
+           }
+         }));
+  report("Map<string, less<>> at(string_view)", measure([&] {
+           unsigned seed = 5;
+           for (int i = 0; i < lookups; ++i) {
+             const char *key = keys[next_random(seed) % n].c_str();
+             g_sink = g_sink + transparent.at(std::string_view(key));
+           }
+         }));
+}
+
+void bench_map_emplace() {
+  const int n = 20000;
+  const int updates = 1000000;
+  std::printf("map_emplace: %d appends into Map<string, vector<int>> "
+              "with %d keys\n",
+              updates, n);
+  s21::vector<std::string> keys(n);
+  char buffer[32];
+  for (int i = 0; i < n; ++i) {
+    std::snprintf(buffer, sizeof(buffer), "session-key-%08d", i);
+    keys[i] = buffer;
+  }
+  // прежний operator[]: пара {key, T()} строится и копируется при каждом
+  // обращении, даже если ключ уже есть
+  report("insert({key, vector()}).first->second", measure([&] {
+           s21::Map<std::string, s21::vector<int>> map;
+           unsigned seed = 9;
+           for (int i = 0; i < updates; ++i) {
+             const std::string &key = keys[next_random(seed) % n];
+             map.insert({key, s21::vector<int>()}).first->second.push_back(i);
+           }
+           g_sink = g_sink + static_cast<int>(map.size());
+         }));
+  report("operator[] via try_emplace", measure([&] {
+           s21::Map<std::string, s21::vector<int>> map;
+           unsigned seed = 9;
+           for (int i = 0; i < updates; ++i)
+             map[keys[next_random(seed) % n]].push_back(i);
+           g_sink = g_sink + static_cast<int>(map.size());
+         }));
+  s21::vector<int> payload(64);
+  report("insert_or_assign(key, const vector &)", measure([&] {
+           s21::Map<std::string, s21::vector<int>> map;
+           unsigned seed = 9;
+           for (int i = 0; i < n * 5; ++i) {
+             s21::vector<int> value(payload);
+             const std::string &key = keys[next_random(seed) % n];
+             map.insert_or_assign(key,
+                                  static_cast<const s21::vector<int> &>(value));
+           }
+           g_sink = g_sink + static_cast<int>(map.size());
+         }));
+  report("insert_or_assign(key, vector &&)", measure([&] {
+           s21::Map<std::string, s21::vector<int>> map;
+           unsigned seed = 9;
+           for (int i = 0; i < n * 5; ++i) {
+             s21::vector<int> value(payload);
+             const std::string &key = keys[next_random(seed) % n];
+             map.insert_or_assign(key, std::move(value));
+           }
+           g_sink = g_sink + static_cast<int>(map.size());
+         }));
+}
+
+void bench_map_bulk_build() {
+  const int n = 2000000;
+  std::printf("map_bulk_build: n=%d pre-sorted keys\n", n);
+  s21::vector<std::pair<int, int>> items(n);
+  for (int i = 0; i < n; ++i)
+    items[i] = {i, i};
+  s21::Map<int, int> source;
+  report("insert one by one", measure([&] {
+           s21::Map<int, int> map;
+           for (int i = 0; i < n; ++i)
+             map.insert(items[i]);
+           source.swap(map);
+         }));
+  report("from_sorted", measure([&] {
+           auto map = s21::Map<int, int>::from_sorted(items.begin(),
+                                                      items.end());
+           g_sink = g_sink + static_cast<int>(map.size());
+         }));
+  // прежний конструктор копирования: повторная вставка в порядке обхода
+  report("copy by re-insert", measure([&] {
+           s21::Map<int, int> map;
+           for (const auto &item : source)
+             map.insert(item);
+           g_sink = g_sink + static_cast<int>(map.size());
+         }));
+  report("copy constructor (clone)", measure([&] {
+           s21::Map<int, int> map(source);
+           g_sink = g_sink + static_cast<int>(map.size());
+         }));
+}
+
+void bench_map_merge() {
+  const int n = 500000;
+  std::printf("map_merge: move %d entries (string values) between maps\n", n);
+  auto fill = [&](s21::Map<int, std::string> &map, int from, int step) {
+    for (int i = 0; i < n; ++i)
+      map.try_emplace(from + i * step, "value-payload-beyond-sso-buffer");
+  };
+  // прежний merge: копия каждого элемента и clear() источника
+  s21::Map<int, std::string> target;
+  s21::Map<int, std::string> source;
+  fill(target, 0, 2);
+  fill(source, 1, 2);
+  report("insert(*it) + other.clear()", measure([&] {
+           for (auto it = source.begin(); it != source.end(); ++it)
+             target.insert(*it);
+           source.clear();
+         }));
+  s21::Map<int, std::string> target2;
+  s21::Map<int, std::string> source2;
+  fill(target2, 0, 2);
+  fill(source2, 1, 2);
+  report("merge (relink nodes)", measure([&] { target2.merge(source2); }));
+  g_sink = g_sink + static_cast<int>(target.size() + target2.size());
+}
+
+void bench_map_window() {
+  const int n = 10000000;
+  const int width = 1000;
+  const int windows = 2000;
+  const int legacy_windows = 20;
+  std::printf("map_window: n=%d keys, windows of %d keys\n", n, width);
+  s21::vector<std::pair<int, int>> items(n);
+  for (int i = 0; i < n; ++i)
+    items[i] = {i * 2, i};
+  auto map = s21::Map<int, int>::from_sorted(items.begin(), items.end());
+  char name[64];
+  // прежний способ: обход от begin() до начала окна
+  std::snprintf(name, sizeof(name), "scan from begin(), %d windows",
+                legacy_windows);
+  report(name, measure([&] {
+           unsigned seed = 13;
+           long long sum = 0;
+           for (int w = 0; w < legacy_windows; ++w) {
+             int from = static_cast<int>(next_random(seed) % (2 * n));
+             auto it = map.begin();
+             while (it != map.end() && it->first < from)
+               ++it;
+             for (; it != map.end() && it->first < from + 2 * width; ++it)
+               sum += it->second;
+           }
+           g_sink = g_sink + static_cast<int>(sum);
+         }));
+  std::snprintf(name, sizeof(name), "lower_bound window, %d windows",
+                windows);
+  report(name, measure([&] {
+           unsigned seed = 13;
+           long long sum = 0;
+           for (int w = 0; w < windows; ++w) {
+             int from = static_cast<int>(next_random(seed) % (2 * n));
+             auto last = map.lower_bound(from + 2 * width);
+             for (auto it = map.lower_bound(from); it != last; ++it)
+               sum += it->second;
+           }
+           g_sink = g_sink + static_cast<int>(sum);
+         }));
+  report("erase(it++) loop, 200 windows", measure([&] {
+           unsigned seed = 17;
+           for (int w = 0; w < 200; ++w) {
+             int from = static_cast<int>(next_random(seed) % (2 * n));
+             auto it = map.lower_bound(from);
+             auto last = map.lower_bound(from + 2 * width);
+             while (it != last)
+               map.erase(it++);
+           }
+         }));
+  report("erase(first, last), 200 windows", measure([&] {
+           unsigned seed = 19;
+           for (int w = 0; w < 200; ++w) {
+             int from = static_cast<int>(next_random(seed) % (2 * n));
+             map.erase(map.lower_bound(from),
+                       map.lower_bound(from + 2 * width));
+           }
+         }));
+  auto copy = map;
+  report("erase(it++) loop, whole map", measure([&] {
+           auto it = copy.begin();
+           while (it != copy.end())
+             copy.erase(it++);
+         }));
+  report("erase(begin(), end())", measure([&] {
+           map.erase(map.begin(), map.end());
+         }));
+  g_sink = g_sink + static_cast<int>(map.size() + copy.size());
+}
+
+void bench_map_percentile() {
+  const int window = 100000;
+  const int stream = 1000000;
+  const int legacy_steps = 200;
+  std::printf("map_percentile: rolling p50/p99 over a %d-sample window\n",
+              window);
+  // ключ — (значение, номер отсчёта), чтобы равные значения не сливались
+  s21::vector<long long> ring(window);
+  s21::Map<long long, int> map;
+  unsigned seed = 21;
+  auto sample = [&](int i) {
+    long long value = static_cast<long long>(next_random(seed) % 100000);
+    return (value << 32) | static_cast<unsigned>(i);
+  };
+  for (int i = 0; i < window; ++i) {
+    ring[i] = sample(i);
+    map.insert({ring[i], i});
+  }
+  auto step = [&](int i) {
+    map.erase(ring[i % window]);
+    ring[i % window] = sample(i);
+    map.insert({ring[i % window], i});
+  };
+  char name[64];
+  std::snprintf(name, sizeof(name), "advance from begin(), %d steps",
+                legacy_steps);
+  report(name, measure([&] {
+           long long sum = 0;
+           for (int i = window; i < window + legacy_steps; ++i) {
+             step(i);
+             auto it = map.begin();
+             for (int k = 0; k < window * 99 / 100; ++k) {
+               if (k == window / 2)
+                 sum += it->first >> 32;
+               ++it;
+             }
+             sum += it->first >> 32;
+           }
+           g_sink = g_sink + static_cast<int>(sum);
+         }));
+  std::snprintf(name, sizeof(name), "select(k), %d steps", stream);
+  report(name, measure([&] {
+           long long sum = 0;
+           int begin = window + legacy_steps;
+           for (int i = begin; i < begin + stream; ++i) {
+             step(i);
+             sum += map.select(window / 2)->first >> 32;
+             sum += map.select(window * 99 / 100)->first >> 32;
+           }
+           g_sink = g_sink + static_cast<int>(sum);
+         }));
+}
+
+template <typename M> void flat_lookup_row(const char *name, int n) {
+  const int lookups = 1000000;
+  s21::vector<std::pair<int, int>> items(n);
+  for (int i = 0; i < n; ++i)
+    items[i] = {i * 2, i};
+  std::size_t bytes = g_bytes;
+  M map(s21::assume_sorted, items.begin(), items.end());
+  double per_entry = static_cast<double>(g_bytes - bytes) / n;
+  Result result = measure([&] {
+    unsigned seed = 23;
+    long long sum = 0;
+    for (int i = 0; i < lookups; ++i)
+      sum += map.contains(static_cast<int>(next_random(seed) % n) * 2);
+    g_sink = g_sink + static_cast<int>(sum);
+  });
+  std::printf("  %-24s n=%-9d %6.1f bytes/entry %8.1f ns/lookup\n", name, n,
+              per_entry, result.ms * 1e6 / lookups);
+}
+
+// для flat_map ёмкость резервируется заранее, а ключи дописываются по
+// возрастанию, иначе в байты попали бы буферы роста и сортировки
+template <>
+void flat_lookup_row<s21::flat_map<int, int>>(const char *name, int n) {
+  const int lookups = 1000000;
+  s21::vector<std::pair<int, int>> items(n);
+  for (int i = 0; i < n; ++i)
+    items[i] = {i * 2, i};
+  std::size_t bytes = g_bytes;
+  s21::flat_map<int, int> map;
+  map.reserve(n);
+  for (int i = 0; i < n; ++i)
+    map.try_emplace(items[i].first, items[i].second);
+  double per_entry = static_cast<double>(g_bytes - bytes) / n;
+  Result result = measure([&] {
+    unsigned seed = 23;
+    long long sum = 0;
+    for (int i = 0; i < lookups; ++i)
+      sum += map.contains(static_cast<int>(next_random(seed) % n) * 2);
+    g_sink = g_sink + static_cast<int>(sum);
+  });
+  std::printf("  %-24s n=%-9d %6.1f bytes/entry %8.1f ns/lookup\n", name, n,
+              per_entry, result.ms * 1e6 / lookups);
+}
+
+void bench_flat_map() {
+  std::printf("flat_map: random hits, requested bytes per entry (int, int)\n");
+  for (int n = 1000; n <= 10000000; n *= 10) {
+    flat_lookup_row<s21::Map<int, int>>("s21::Map", n);
+    flat_lookup_row<s21::flat_map<int, int>>("s21::flat_map", n);
+  }
+  const int n = 1000000;
+  const int batch = 100000;
+  s21::vector<std::pair<int, int>> items(batch);
+  unsigned seed = 29;
+  for (int i = 0; i < batch; ++i)
+    items[i] = {static_cast<int>(next_random(seed) % (4 * n)), i};
+  s21::flat_map<int, int> one_by_one;
+  s21::flat_map<int, int> bulk;
+  for (int i = 0; i < n; ++i) {
+    one_by_one.try_emplace(i * 4 + 1, i);
+    bulk.try_emplace(i * 4 + 1, i);
+  }
+  // по одному — только первые 1000 ключей, каждая вставка сдвигает хвост
+  report("flat_map insert 1k into 1M, one by one", measure([&] {
+           for (int i = 0; i < 1000; ++i)
+             one_by_one.insert(items[i]);
+         }));
+  report("flat_map insert(first, last) 100k into 1M", measure([&] {
+           bulk.insert(items.begin(), items.end());
+         }));
+  g_sink = g_sink + static_cast<int>(one_by_one.size() + bulk.size());
+}
+
+// вставка n случайных чётных ключей, затем 1M поисков существующих ключей и
+// 1M поисков нечётных, которых в таблице нет
+template <typename M> void hash_lookup_row(const char *name, int n) {
+  const int lookups = 1000000;
+  s21::vector<int> keys(n);
+  unsigned seed = 31;
+  for (int i = 0; i < n; ++i)
+    keys[i] = static_cast<int>(next_random(seed) & ~1u);
+  std::size_t bytes = g_bytes;
+  M map;
+  Result insert = measure([&] {
+    for (int i = 0; i < n; ++i)
+      map[keys[i]] = i;
+  });
+  double per_entry = static_cast<double>(g_bytes - bytes) / n;
+  Result hit = measure([&] {
+    long long sum = 0;
+    for (int i = 0; i < lookups; ++i)
+      sum += map.count(keys[next_random(seed) % n]);
+    g_sink = g_sink + static_cast<int>(sum);
+  });
+  Result miss = measure([&] {
+    long long sum = 0;
+    for (int i = 0; i < lookups; ++i)
+      sum += map.count(static_cast<int>(next_random(seed) | 1u));
+    g_sink = g_sink + static_cast<int>(sum);
+  });
+  std::printf("  %-24s n=%-9d %6.1f bytes/entry %7.1f ns/insert %7.1f "
+              "ns/hit %7.1f ns/miss\n",
+              name, n, per_entry, insert.ms * 1e6 / n,
+              hit.ms * 1e6 / lookups, miss.ms * 1e6 / lookups);
+}
+
+void bench_unordered_map() {
+  std::printf("unordered_map: random int keys, requested bytes per entry\n");
+  for (int n = 1000; n <= 10000000; n *= 10) {
+    hash_lookup_row<s21::Map<int, int>>("s21::Map", n);
+    hash_lookup_row<std::unordered_map<int, int>>("std::unordered_map", n);
+    hash_lookup_row<s21::unordered_map<int, int>>("s21::unordered_map", n);
+  }
+}
+
+// ops операций делятся поровну между threads потоками; ключи из 1M уже
+// вставленных, запись — insert_or_assign, каждая сотая запись — erase
+template <typename Table>
+void concurrent_row(const char *name, Table &table, int threads,
+                    int write_percent) {
+  const int ops = 4000000;
+  const int keys = 1000000;
+  s21::vector<std::thread> workers(threads);
+  Result result = measure([&] {
+    for (int t = 0; t < threads; ++t) {
+      workers[t] = std::thread([&table, t, threads, write_percent] {
+        unsigned seed = 37 + t;
+        long long sum = 0;
+        for (int i = 0; i < ops / threads; ++i) {
+          unsigned r = next_random(seed);
+          int key = static_cast<int>(r % keys);
+          if (static_cast<int>(r >> 24) % 100 >= write_percent)
+            sum += table.find(key);
+          else if (r % 100 == 0)
+            table.erase(key);
+          else
+            table.insert_or_assign(key, i);
+        }
+        g_sink = g_sink + static_cast<int>(sum);
+      });
+    }
+    for (int t = 0; t < threads; ++t)
+      workers[t].join();
+  });
+  std::printf("  %-28s threads=%-2d writes=%2d%% %8.2f Mops/s\n", name,
+              threads, write_percent, ops / result.ms / 1000.0);
+}
+
+// одна таблица за одним мьютексом: s21::Map — то, что заменяет
+// concurrent_map, s21::unordered_map отделяет выигрыш шардов от выигрыша
+// хеш-таблицы
+template <typename M> struct locked_map {
+  std::mutex mutex;
+  M map;
+
+  long long find(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return map.contains(key);
+  }
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    map.erase(key);
+  }
+  void insert_or_assign(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    map.insert_or_assign(key, value);
+  }
+};
+
+struct sharded_map {
+  s21::concurrent_map<int, int> map{64};
+
+  long long find(int key) { return map.find(key).has_value(); }
+  void erase(int key) { map.erase(key); }
+  void insert_or_assign(int key, int value) {
+    map.insert_or_assign(key, value);
+  }
+};
+
+void bench_concurrent_map() {
+  std::printf("concurrent_map: 4M ops over 1M int keys, %u hardware threads\n",
+              std::thread::hardware_concurrency());
+  locked_map<s21::Map<int, int>> locked;
+  locked_map<s21::unordered_map<int, int>> locked_hash;
+  sharded_map sharded;
+  for (int key = 0; key < 1000000; ++key) {
+    locked.map.insert_or_assign(key, key);
+    locked_hash.map.insert_or_assign(key, key);
+    sharded.map.insert(key, key);
+  }
+  const int mixes[] = {5, 50};
+  for (int writes : mixes) {
+    for (int threads = 1; threads <= 8; threads *= 2) {
+      concurrent_row("s21::Map + std::mutex", locked, threads, writes);
+      concurrent_row("unordered_map + std::mutex", locked_hash, threads,
+                     writes);
+      concurrent_row("s21::concurrent_map (64)", sharded, threads, writes);
+    }
+  }
+  std::pair<int, int> batch[1000];
+  int batch_keys[1000];
+  std::optional<int> found[1000];
+  for (int i = 0; i < 1000; ++i) {
+    batch[i] = {i * 997 % 1000000, i};
+    batch_keys[i] = batch[i].first;
+  }
+  report("find x1000, lock per key", measure([&] {
+           long long sum = 0;
+           for (int round = 0; round < 1000; ++round) {
+             for (int i = 0; i < 1000; ++i)
+               sum += sharded.map.find(batch_keys[i]).has_value();
+           }
+           g_sink = g_sink + static_cast<int>(sum);
+         }));
+  report("find_many x1000, lock per shard", measure([&] {
+           for (int round = 0; round < 1000; ++round)
+             sharded.map.find_many(batch_keys, batch_keys + 1000, found);
+         }));
+  report("insert_many x1000 existing keys", measure([&] {
+           for (int round = 0; round < 1000; ++round)
+             sharded.map.insert_many(batch, batch + 1000);
+         }));
+}
+
+// отчёт по снимкам: n ключей, rounds раз по 10 изменений и снимок, все
+// снимки хранятся до конца; байты — запрошенные у operator new
+void bench_persistent_map() {
+  const int n = 1000000;
+  std::printf("persistent_map: %d int keys\n", n);
+  s21::Map<int, int> map;
+  s21::persistent_map<int, int> versioned;
+  unsigned seed = 41;
+  for (int i = 0; i < n; ++i) {
+    int key = static_cast<int>(next_random(seed) % (4 * n));
+    map.insert_or_assign(key, i);
+    versioned = versioned.insert_or_assign(key, i);
+  }
+  report("Map snapshot (copy constructor)", measure([&] {
+           s21::Map<int, int> copy(map);
+           g_sink = g_sink + static_cast<int>(copy.size());
+         }));
+  report("persistent_map snapshot", measure([&] {
+           s21::persistent_map<int, int> copy(versioned);
+           g_sink = g_sink + static_cast<int>(copy.size());
+         }));
+  report("Map insert_or_assign x100k", measure([&] {
+           for (int i = 0; i < 100000; ++i)
+             map.insert_or_assign(static_cast<int>(next_random(seed) % n), i);
+         }));
+  report("persistent_map insert_or_assign x100k", measure([&] {
+           for (int i = 0; i < 100000; ++i)
+             versioned = versioned.insert_or_assign(
+                 static_cast<int>(next_random(seed) % n), i);
+         }));
+  report("Map find x1M", measure([&] {
+           long long sum = 0;
+           for (int i = 0; i < 1000000; ++i)
+             sum += map.contains(static_cast<int>(next_random(seed) % n));
+           g_sink = g_sink + static_cast<int>(sum);
+         }));
+  report("persistent_map find x1M", measure([&] {
+           long long sum = 0;
+           for (int i = 0; i < 1000000; ++i)
+             sum += versioned.contains(static_cast<int>(next_random(seed) % n));
+           g_sink = g_sink + static_cast<int>(sum);
+         }));
+  const int rounds = 20;
+  std::printf("  %d rounds of 10 updates + snapshot, all snapshots kept\n",
+              rounds);
+  {
+    std::size_t bytes = g_bytes;
+    s21::vector<s21::Map<int, int>> kept;
+    kept.reserve(rounds);
+    Result result = measure([&] {
+      for (int round = 0; round < rounds; ++round) {
+        for (int i = 0; i < 10; ++i)
+          map.insert_or_assign(static_cast<int>(next_random(seed) % n), i);
+        kept.push_back(map);
+      }
+    });
+    std::printf("  %-44s %10.2f ms %10.1f MB\n", "Map copies", result.ms,
+                (g_bytes - bytes) / 1048576.0);
+  }
+  {
+    std::size_t bytes = g_bytes;
+    s21::vector<s21::persistent_map<int, int>> kept;
+    kept.reserve(rounds);
+    Result result = measure([&] {
+      for (int round = 0; round < rounds; ++round) {
+        for (int i = 0; i < 10; ++i)
+          versioned = versioned.insert_or_assign(
+              static_cast<int>(next_random(seed) % n), i);
+        kept.push_back(versioned);
+      }
+    });
+    std::printf("  %-44s %10.2f ms %10.1f MB\n", "persistent_map versions",
+                result.ms, (g_bytes - bytes) / 1048576.0);
+  }
+}
+
+// читатели ищут случайные ключи, а фоновый писатель раз в 100 мкс меняет
+// одно значение; Table даёт reader_for() и update(key, value)
+template <typename Table>
+void read_mostly_row(const char *name, Table &table, int keys, int readers) {
+  const int lookups = 2000000;
+  std::atomic<bool> stop{false};
+  std::atomic<int> updates{0};
+  std::thread writer([&] {
+    unsigned seed = 53;
+    while (!stop.load(std::memory_order_relaxed)) {
+      table.update(static_cast<int>(next_random(seed) % keys), 1);
+      updates.fetch_add(1, std::memory_order_relaxed);
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  });
+  s21::vector<std::thread> workers(readers);
+  Result result = measure([&] {
+    for (int t = 0; t < readers; ++t) {
+      workers[t] = std::thread([&table, t, keys, readers] {
+        auto reader = table.reader_for();
+        unsigned seed = 59 + t;
+        long long sum = 0;
+        for (int i = 0; i < lookups / readers; ++i)
+          sum += reader.contains(static_cast<int>(next_random(seed) % keys));
+        g_sink = g_sink + static_cast<int>(sum);
+      });
+    }
+    for (int t = 0; t < readers; ++t)
+      workers[t].join();
+  });
+  stop = true;
+  writer.join();
+  std::printf("  %-26s n=%-8d readers=%d %7.2f Mreads/s %6d updates\n", name,
+              keys, readers, lookups / result.ms / 1000.0, updates.load());
+}
+
+// Map за shared_mutex: читатели берут разделяемую блокировку на поиск
+struct shared_locked_map {
+  std::shared_mutex mutex;
+  s21::Map<int, int> map;
+
+  struct reader {
+    shared_locked_map *owner;
+    bool contains(int key) {
+      std::shared_lock<std::shared_mutex> lock(owner->mutex);
+      return owner->map.contains(key);
+    }
+  };
+  reader reader_for() { return reader{this}; }
+  void update(int key, int value) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    map.insert_or_assign(key, value);
+  }
+};
+
+struct rcu_table {
+  s21::rcu_map<int, int> map{16};
+
+  s21::rcu_map<int, int>::reader reader_for() {
+    return map.register_reader();
+  }
+  void update(int key, int value) { map.insert_or_assign(key, value); }
+};
+
+void bench_rcu_map() {
+  std::printf("rcu_map: 2M lookups across readers, writer every 100 us\n");
+  const int sizes[] = {1000, 1000000};
+  for (int keys : sizes) {
+    shared_locked_map locked;
+    rcu_table rcu;
+    rcu.map.update([keys](s21::persistent_map<int, int> &version) {
+      for (int key = 0; key < keys; ++key)
+        version = version.insert(key, key);
+    });
+    for (int key = 0; key < keys; ++key)
+      locked.map.insert_or_assign(key, key);
+    for (int readers = 1; readers <= 4; readers *= 2) {
+      read_mostly_row("s21::Map + shared_mutex", locked, keys, readers);
+      read_mostly_row("s21::rcu_map", rcu, keys, readers);
+    }
+  }
+}
+
+// у skiplist нет замены значения на месте: запись — insert, который для
+// существующего ключа ничего не делает, как и после erase — вставка
+struct skiplist_table {
+  s21::concurrent_skiplist_map<int, int> map;
+
+  long long find(int key) { return map.contains(key); }
+  void erase(int key) { map.erase(key); }
+  void insert_or_assign(int key, int value) { map.insert(key, value); }
+};
+
+void bench_skiplist_map() {
+  std::printf("skiplist_map: 4M ops over 1M int keys, %u hardware threads\n",
+              std::thread::hardware_concurrency());
+  locked_map<s21::Map<int, int>> locked;
+  skiplist_table skiplist;
+  for (int key = 0; key < 1000000; ++key) {
+    locked.map.insert_or_assign(key, key);
+    skiplist.map.insert(key, key);
+  }
+  const int mixes[] = {5, 50};
+  for (int writes : mixes) {
+    for (int threads = 1; threads <= 8; threads *= 2) {
+      concurrent_row("s21::Map + std::mutex", locked, threads, writes);
+      concurrent_row("s21::concurrent_skiplist_map", skiplist, threads,
+                     writes);
+    }
+  }
+  report("ordered scan of 1M, s21::Map + mutex", measure([&] {
+           std::lock_guard<std::mutex> lock(locked.mutex);
+           long long sum = 0;
+           for (auto &item : locked.map)
+             sum += item.second;
+           g_sink = g_sink + static_cast<int>(sum);
+         }));
+  report("ordered scan of 1M, skiplist", measure([&] {
+           long long sum = 0;
+           for (auto &item : skiplist.map)
+             sum += item.second;
+           g_sink = g_sink + static_cast<int>(sum);
+         }));
+}
+
+// ключи вставляются в случайном порядке, чтобы соседние по ключу узлы не
+// лежали рядом в памяти; половина искомых ключей отсутствует
+void bench_map_find_batch() {
+  const int lookups = 2000000;
+  const int batch = 1000;
+  std::printf("map_find_batch: %d lookups in batches of %d\n", lookups,
+              batch);
+  const int sizes[] = {1000, 1000000, 8000000};
+  for (int n : sizes) {
+    s21::vector<int> order(n);
+    for (int i = 0; i < n; ++i)
+      order.begin()[i] = i;
+    unsigned seed = 17;
+    for (int i = n - 1; i > 0; --i)
+      std::swap(order.begin()[i], order.begin()[next_random(seed) % (i + 1)]);
+    s21::Map<int, int> map;
+    for (int i = 0; i < n; ++i)
+      map.try_emplace(order.begin()[i] * 2, i);
+    s21::vector<int> keys(lookups);
+    for (int i = 0; i < lookups; ++i)
+      keys.begin()[i] = static_cast<int>(next_random(seed) % (2u * n));
+    s21::vector<s21::Map<int, int>::iterator> found(batch);
+    bool present[batch];
+    char name[64];
+    std::snprintf(name, sizeof(name), "n=%d find one by one", n);
+    report(name, measure([&] {
+             long long sum = 0;
+             for (int i = 0; i < lookups; ++i) {
+               auto *node = map.find(keys.begin()[i]);
+               if (node)
+                 sum += node->data.second;
+             }
+             g_sink = g_sink + static_cast<int>(sum);
+           }));
+    std::snprintf(name, sizeof(name), "n=%d find_batch", n);
+    report(name, measure([&] {
+             long long sum = 0;
+             for (int i = 0; i < lookups; i += batch) {
+               map.find_batch(keys.begin() + i, keys.begin() + i + batch,
+                              found.begin());
+               for (int j = 0; j < batch; ++j) {
+                 if (found.begin()[j] != map.end())
+                   sum += found.begin()[j]->second;
+               }
+             }
+             g_sink = g_sink + static_cast<int>(sum);
+           }));
+    std::snprintf(name, sizeof(name), "n=%d contains one by one", n);
+    report(name, measure([&] {
+             int hits = 0;
+             for (int i = 0; i < lookups; ++i)
+               hits += map.contains(keys.begin()[i]);
+             g_sink = g_sink + hits;
+           }));
+    std::snprintf(name, sizeof(name), "n=%d contains_batch", n);
+    report(name, measure([&] {
+             int hits = 0;
+             for (int i = 0; i < lookups; i += batch) {
+               map.contains_batch(keys.begin() + i,
+                                  keys.begin() + i + batch, present);
+               for (int j = 0; j < batch; ++j)
+                 hits += present[j];
+             }
+             g_sink = g_sink + hits;
+           }));
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (selected(argc, argv, "list_pool"))
+    bench_list_pool();
+  if (selected(argc, argv, "list_sort"))
+    bench_list_sort();
+  if (selected(argc, argv, "list_merge"))
+    bench_list_merge();
+  if (selected(argc, argv, "list_sentinel"))
+    bench_list_sentinel();
+  if (selected(argc, argv, "insert_many"))
+    bench_insert_many();
+  if (selected(argc, argv, "erase_if"))
+    bench_erase_if();
+  if (selected(argc, argv, "lru_cache"))
+    bench_lru_cache();
+  if (selected(argc, argv, "map_sorted_insert"))
+    bench_map_sorted_insert();
+  if (selected(argc, argv, "map_string_lookup"))
+    bench_map_string_lookup();
+  if (selected(argc, argv, "map_emplace"))
+    bench_map_emplace();
+  if (selected(argc, argv, "map_bulk_build"))
+    bench_map_bulk_build();
+  if (selected(argc, argv, "map_merge"))
+    bench_map_merge();
+  if (selected(argc, argv, "map_window"))
+    bench_map_window();
+  if (selected(argc, argv, "map_percentile"))
+    bench_map_percentile();
+  if (selected(argc, argv, "flat_map"))
+    bench_flat_map();
+  if (selected(argc, argv, "unrolled_list"))
+    bench_unrolled_list();
+  if (selected(argc, argv, "intrusive_list"))
+    bench_intrusive_list();
+  if (selected(argc, argv, "compact_list"))
+    bench_compact_list();
+  if (selected(argc, argv, "unordered_map"))
+    bench_unordered_map();
+  if (selected(argc, argv, "concurrent_map"))
+    bench_concurrent_map();
+  if (selected(argc, argv, "persistent_map"))
+    bench_persistent_map();
+  if (selected(argc, argv, "rcu_map"))
+    bench_rcu_map();
+  if (selected(argc, argv, "skiplist_map"))
+    bench_skiplist_map();
+  if (selected(argc, argv, "map_find_batch"))
+    bench_map_find_batch();
+  return 0;
+}
@@ -0,0 +1,307 @@
+#include "s21_compact_list.h"
+
+namespace s21 {
+
+// Итераторы хранят индекс ячейки, поэтому переживают рост массива
+template <typename T> T &compact_list<T>::Iterator::operator*() {
+  return *list_->slots_[index_].value();
+}
+
+template <typename T>
+typename compact_list<T>::Iterator &compact_list<T>::Iterator::operator++() {
+  index_ = list_->slots_[index_].next;
+  return *this;
+}
+
+template <typename T>
+typename compact_list<T>::Iterator &compact_list<T>::Iterator::operator--() {
+  if (list_->slots_)
+    index_ = list_->slots_[index_].prev;
+  return *this;
+}
+
+template <typename T>
+bool compact_list<T>::Iterator::operator==(const Iterator &other) const {
+  return index_ == other.index_ && list_ == other.list_;
+}
+
+template <typename T>
+bool compact_list<T>::Iterator::operator!=(const Iterator &other) const {
+  return !(*this == other);
+}
+
+// методы compact_list
+
+template <typename T>
+compact_list<T>::compact_list()
+    : slots_(nullptr), capacity_(0), used_(0), free_(kNone), length(0) {}
+
+template <typename T> compact_list<T>::compact_list(size_t n) : compact_list() {
+  reserve(n);
+  for (size_t i = 0; i < n; ++i)
+    push_back(T());
+}
+
+template <typename T>
+compact_list<T>::compact_list(std::initializer_list<T> const &items)
+    : compact_list() {
+  reserve(items.size());
+  for (const T &value : items)
+    push_back(value);
+}
+
+// для тривиально копируемых T копия — один memcpy массива ячеек
+template <typename T>
+compact_list<T>::compact_list(const compact_list &other) : compact_list() {
+  if (!other.length)
+    return;
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    grow(other.used_);
+    std::memcpy(static_cast<void *>(slots_), other.slots_,
+                other.used_ * sizeof(Slot));
+    used_ = other.used_;
+    free_ = other.free_;
+    length = other.length;
+  } else {
+    reserve(other.length);
+    for (index_type i = other.slots_[0].next; i != kNone;
+         i = other.slots_[i].next)
+      push_back(*other.slots_[i].value());
+  }
+}
+
+template <typename T>
+compact_list<T>::compact_list(compact_list &&other) noexcept
+    : compact_list() {
+  swap(other);
+}
+
+template <typename T> compact_list<T>::~compact_list() {
+  clear();
+  ::operator delete(slots_, std::align_val_t(alignof(Slot)));
+}
+
+template <typename T>
+compact_list<T> &compact_list<T>::operator=(compact_list &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T> T &compact_list<T>::front() {
+  return *slots_[slots_[0].next].value();
+}
+
+template <typename T> const T &compact_list<T>::front() const {
+  return *slots_[slots_[0].next].value();
+}
+
+template <typename T> T &compact_list<T>::back() {
+  return *slots_[slots_[0].prev].value();
+}
+
+template <typename T> const T &compact_list<T>::back() const {
+  return *slots_[slots_[0].prev].value();
+}
+
+template <typename T>
+typename compact_list<T>::Iterator compact_list<T>::begin() {
+  return Iterator(this, slots_ ? slots_[0].next : kNone);
+}
+
+template <typename T>
+typename compact_list<T>::Iterator compact_list<T>::end() {
+  return Iterator(this, kNone);
+}
+
+template <typename T> bool compact_list<T>::empty() const {
+  return length == 0;
+}
+
+template <typename T> size_t compact_list<T>::size() const { return length; }
+
+template <typename T> size_t compact_list<T>::max_size() const {
+  size_t by_memory = static_cast<size_t>(-1) / sizeof(Slot) - 1;
+  size_t by_index = static_cast<size_t>(kFree) - 1;
+  return by_memory < by_index ? by_memory : by_index;
+} // индекс kFree помечает свободные ячейки, 0 занят сторожем
+
+template <typename T> size_t compact_list<T>::capacity() const {
+  return capacity_ ? capacity_ - 1 : 0;
+}
+
+template <typename T> void compact_list<T>::reserve(size_t n) {
+  if (n > max_size())
+    throw std::length_error("compact_list::reserve");
+  if (n + 1 > capacity_)
+    grow(n + 1);
+}
+
+// для тривиально разрушаемых T clear — O(1), массив остаётся для повторного
+// заполнения
+template <typename T> void compact_list<T>::clear() {
+  if (!slots_)
+    return;
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (index_type i = slots_[0].next; i != kNone; i = slots_[i].next)
+      slots_[i].value()->~T();
+  }
+  slots_[0].next = slots_[0].prev = kNone;
+  used_ = 1;
+  free_ = kNone;
+  length = 0;
+}
+
+template <typename T>
+typename compact_list<T>::Iterator compact_list<T>::insert(Iterator pos,
+                                                           const T &value) {
+  index_type index = acquire(value);
+  link(pos.index_, index);
+  ++length;
+  return Iterator(this, index);
+}
+
+template <typename T>
+typename compact_list<T>::Iterator compact_list<T>::insert(Iterator pos,
+                                                           T &&value) {
+  index_type index = acquire(std::move(value));
+  link(pos.index_, index);
+  ++length;
+  return Iterator(this, index);
+}
+
+template <typename T> void compact_list<T>::erase(Iterator pos) {
+  if (pos.index_ != kNone) {
+    unlink(pos.index_);
+    release(pos.index_);
+    --length;
+  }
+}
+
+template <typename T> void compact_list<T>::push_back(const T &value) {
+  insert(end(), value);
+}
+
+template <typename T> void compact_list<T>::push_back(T &&value) {
+  insert(end(), std::move(value));
+}
+
+template <typename T> void compact_list<T>::pop_back() {
+  if (length)
+    erase(Iterator(this, slots_[0].prev));
+}
+
+template <typename T> void compact_list<T>::push_front(const T &value) {
+  insert(begin(), value);
+}
+
+template <typename T> void compact_list<T>::push_front(T &&value) {
+  insert(begin(), std::move(value));
+}
+
+template <typename T> void compact_list<T>::pop_front() {
+  if (!length)
+    throw std::out_of_range("pop_front() called on empty list");
+  erase(begin());
+}
+
+template <typename T> void compact_list<T>::swap(compact_list &other) noexcept {
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(used_, other.used_);
+  std::swap(free_, other.free_);
+  std::swap(length, other.length);
+}
+
+/**
+ * acquire() конструирует значение в свободной ячейке и возвращает её индекс.
+ * Если массив нужно расширить, значение сначала собирается во временный
+ * объект: аргументы могут ссылаться на элементы этого же списка.
+ */
+template <typename T>
+template <typename... Args>
+typename compact_list<T>::index_type compact_list<T>::acquire(Args &&...args) {
+  if (free_ == kNone && used_ == capacity_) {
+    T value(std::forward<Args>(args)...);
+    size_t limit = max_size() + 1;
+    if (capacity_ == limit)
+      throw std::length_error("compact_list is full");
+    grow(capacity_ < 16 ? 16 : capacity_ > limit / 2 ? limit : capacity_ * 2);
+    new (slots_[used_].value()) T(std::move(value));
+    return static_cast<index_type>(used_++);
+  }
+  index_type index = free_ != kNone ? free_ : static_cast<index_type>(used_);
+  new (slots_[index].value()) T(std::forward<Args>(args)...);
+  if (index == free_)
+    free_ = slots_[index].next;
+  else
+    ++used_;
+  return index;
+}
+
+template <typename T> void compact_list<T>::release(index_type index) noexcept {
+  slots_[index].value()->~T();
+  slots_[index].prev = kFree;
+  slots_[index].next = free_;
+  free_ = index;
+}
+
+template <typename T>
+void compact_list<T>::link(index_type pos, index_type index) noexcept {
+  index_type prev = slots_[pos].prev;
+  slots_[index].prev = prev;
+  slots_[index].next = pos;
+  slots_[prev].next = index;
+  slots_[pos].prev = index;
+}
+
+template <typename T> void compact_list<T>::unlink(index_type index) noexcept {
+  slots_[slots_[index].prev].next = slots_[index].next;
+  slots_[slots_[index].next].prev = slots_[index].prev;
+}
+
+/**
+ * grow переносит ячейки в массив из n ячеек; индексы при этом не меняются.
+ * Элементы перемещаются, только если перемещение не бросает, иначе
+ * копируются. При исключении уже построенные в новом массиве разрушаются,
+ * и список остаётся в старом.
+ */
+template <typename T> void compact_list<T>::grow(size_t n) {
+  Slot *slots = static_cast<Slot *>(
+      ::operator new(n * sizeof(Slot), std::align_val_t(alignof(Slot))));
+  if (!slots_) {
+    slots[0].next = slots[0].prev = kNone;
+    used_ = 1;
+  } else if constexpr (std::is_trivially_copyable<T>::value) {
+    std::memcpy(static_cast<void *>(slots), slots_, used_ * sizeof(Slot));
+  } else {
+    size_t i = 0;
+    try {
+      for (; i < used_; ++i) {
+        slots[i].next = slots_[i].next;
+        slots[i].prev = slots_[i].prev;
+        if (i != 0 && slots_[i].prev != kFree)
+          new (slots[i].value()) T(std::move_if_noexcept(*slots_[i].value()));
+      }
+    } catch (...) {
+      for (size_t j = 1; j < i; ++j) {
+        if (slots[j].prev != kFree)
+          slots[j].value()->~T();
+      }
+      ::operator delete(slots, std::align_val_t(alignof(Slot)));
+      throw;
+    }
+    for (i = 1; i < used_; ++i) {
+      if (slots_[i].prev != kFree)
+        slots_[i].value()->~T();
+    }
+  }
+  if (slots_)
+    ::operator delete(slots_, std::align_val_t(alignof(Slot)));
+  slots_ = slots;
+  capacity_ = n;
+}
+
+} // namespace s21
@@ -0,0 +1,105 @@
+#ifndef S21_COMPACT_LIST_H_
+#define S21_COMPACT_LIST_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Двусвязный список в одном непрерывном массиве: вместо указателей узлы
+// хранят 32-битные индексы соседей, освобождённые ячейки идут в список
+// свободных. Ячейка 0 — сторож, end() указывает на неё.
+template <typename T> class compact_list {
+public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using index_type = std::uint32_t;
+
+  struct Slot {
+    index_type next;
+    index_type prev;
+    alignas(T) unsigned char storage[sizeof(T)];
+    T *value() { return reinterpret_cast<T *>(storage); }
+  };
+
+  class Iterator {
+  public:
+    typedef std::ptrdiff_t difference_type;
+    explicit Iterator(compact_list *list, index_type index)
+        : list_(list), index_(index){};
+    T &operator*();
+    Iterator &operator++();
+    Iterator &operator--();
+    bool operator==(const Iterator &other) const;
+    bool operator!=(const Iterator &other) const;
+
+  private:
+    friend class compact_list;
+    compact_list *list_;
+    index_type index_;
+  };
+
+  compact_list();
+  explicit compact_list(size_t n);
+  compact_list(std::initializer_list<T> const &items);
+  compact_list(const compact_list &other);
+  compact_list(compact_list &&other) noexcept;
+  ~compact_list();
+  compact_list &operator=(compact_list &&other) noexcept;
+  static size_t slot_size() { return sizeof(Slot); }
+
+  T &front();
+  const T &front() const;
+  T &back();
+  const T &back() const;
+
+  Iterator begin();
+  Iterator end();
+
+  bool empty() const;
+  size_t size() const;
+  size_t max_size() const;
+  size_t capacity() const;
+  void reserve(size_t n);
+
+  void clear();
+  Iterator insert(Iterator pos, const T &value);
+  Iterator insert(Iterator pos, T &&value);
+  void erase(Iterator pos);
+  void push_back(const T &value);
+  void push_back(T &&value);
+  void pop_back();
+  void push_front(const T &value);
+  void push_front(T &&value);
+  void pop_front();
+  void swap(compact_list &other) noexcept;
+
+private:
+  static constexpr index_type kNone = 0;
+  static constexpr index_type kFree = ~index_type(0);
+
+  Slot *slots_;
+  size_t capacity_; // ячеек в массиве, включая сторожа
+  size_t used_;     // ячейки [0, used_) хоть раз выдавались
+  index_type free_;
+  size_t length;
+
+  template <typename... Args> index_type acquire(Args &&...args);
+  void release(index_type index) noexcept;
+  void link(index_type pos, index_type index) noexcept;
+  void unlink(index_type index) noexcept;
+  void grow(size_t n);
+};
+
+} // namespace s21
+
+#include "s21_compact_list.cpp"
+#endif // S21_COMPACT_LIST_H_
@@ -0,0 +1,244 @@
+#include "s21_concurrent_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+concurrent_map<Key, T, Hash, KeyEqual>::concurrent_map(size_type shards)
+    : shards_(), shard_count_(1), shift_(64), hash_() {
+  while (shard_count_ < shards) {
+    shard_count_ *= 2;
+    --shift_;
+  }
+  shards_.reset(new Shard[shard_count_]);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::optional<T>
+concurrent_map<Key, T, Hash, KeyEqual>::find(const Key &key) const {
+  const Shard &shard = shards_[shard_of(key)];
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.map.find(key);
+  if (it == shard.map.end())
+    return std::nullopt;
+  return it->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool concurrent_map<Key, T, Hash, KeyEqual>::contains(const Key &key) const {
+  const Shard &shard = shards_[shard_of(key)];
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.contains(key);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool concurrent_map<Key, T, Hash, KeyEqual>::insert(const Key &key,
+                                                    const T &value) {
+  Shard &shard = shards_[shard_of(key)];
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.try_emplace(key, value).second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool concurrent_map<Key, T, Hash, KeyEqual>::insert(Key &&key, T &&value) {
+  Shard &shard = shards_[shard_of(key)];
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.try_emplace(std::move(key), std::move(value)).second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool concurrent_map<Key, T, Hash, KeyEqual>::insert_or_assign(
+    const Key &key, const T &value) {
+  Shard &shard = shards_[shard_of(key)];
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.insert_or_assign(key, value).second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename concurrent_map<Key, T, Hash, KeyEqual>::size_type
+concurrent_map<Key, T, Hash, KeyEqual>::erase(const Key &key) {
+  Shard &shard = shards_[shard_of(key)];
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.map.erase(key);
+}
+
+/**
+ * Сначала ключ ищется под разделяемой блокировкой, так что частый случай
+ * «значение уже есть» не сериализует читателей. Если ключа нет, поиск
+ * повторяется под исключительной блокировкой: другой поток мог успеть
+ * вставить значение. make() вызывается не больше одного раза на ключ и
+ * под блокировкой шарда, поэтому не должен обращаться к этой же карте.
+ */
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename F>
+T concurrent_map<Key, T, Hash, KeyEqual>::compute_if_absent(const Key &key,
+                                                            F &&make) {
+  Shard &shard = shards_[shard_of(key)];
+  {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it != shard.map.end())
+      return it->second;
+  }
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.map.find(key);
+  if (it == shard.map.end())
+    it = shard.map.try_emplace(key, make()).first;
+  return it->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename KeyIt, typename OutIt>
+void concurrent_map<Key, T, Hash, KeyEqual>::find_many(KeyIt first,
+                                                       KeyIt last,
+                                                       OutIt out) const {
+  vector<size_type> order;
+  vector<size_type> bounds;
+  group_by_shard(first, static_cast<size_type>(last - first),
+                 [](const Key &key) -> const Key & { return key; }, order,
+                 bounds);
+  const size_type *index = order.begin();
+  for (size_type s = 0; s < shard_count_; ++s) {
+    const size_type *end = order.begin() + bounds.begin()[s + 1];
+    if (index == end)
+      continue;
+    const Shard &shard = shards_[s];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    for (; index != end; ++index) {
+      auto it = shard.map.find(first[*index]);
+      if (it == shard.map.end())
+        out[*index] = std::nullopt;
+      else
+        out[*index] = it->second;
+    }
+  }
+}
+
+// уже существующие ключи не перезаписываются; возвращает число вставленных
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename PairIt>
+typename concurrent_map<Key, T, Hash, KeyEqual>::size_type
+concurrent_map<Key, T, Hash, KeyEqual>::insert_many(PairIt first,
+                                                    PairIt last) {
+  vector<size_type> order;
+  vector<size_type> bounds;
+  group_by_shard(
+      first, static_cast<size_type>(last - first),
+      [](const auto &item) -> const Key & { return item.first; }, order,
+      bounds);
+  size_type inserted = 0;
+  const size_type *index = order.begin();
+  for (size_type s = 0; s < shard_count_; ++s) {
+    const size_type *end = order.begin() + bounds.begin()[s + 1];
+    if (index == end)
+      continue;
+    Shard &shard = shards_[s];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    for (; index != end; ++index) {
+      const auto &item = first[*index];
+      inserted += shard.map.try_emplace(item.first, item.second).second;
+    }
+  }
+  return inserted;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename KeyIt>
+typename concurrent_map<Key, T, Hash, KeyEqual>::size_type
+concurrent_map<Key, T, Hash, KeyEqual>::erase_many(KeyIt first, KeyIt last) {
+  vector<size_type> order;
+  vector<size_type> bounds;
+  group_by_shard(first, static_cast<size_type>(last - first),
+                 [](const Key &key) -> const Key & { return key; }, order,
+                 bounds);
+  size_type erased = 0;
+  const size_type *index = order.begin();
+  for (size_type s = 0; s < shard_count_; ++s) {
+    const size_type *end = order.begin() + bounds.begin()[s + 1];
+    if (index == end)
+      continue;
+    Shard &shard = shards_[s];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    for (; index != end; ++index)
+      erased += shard.map.erase(first[*index]);
+  }
+  return erased;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename concurrent_map<Key, T, Hash, KeyEqual>::size_type
+concurrent_map<Key, T, Hash, KeyEqual>::size() const {
+  size_type total = 0;
+  for (size_type s = 0; s < shard_count_; ++s) {
+    std::shared_lock<std::shared_mutex> lock(shards_[s].mutex);
+    total += shards_[s].map.size();
+  }
+  return total;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool concurrent_map<Key, T, Hash, KeyEqual>::empty() const {
+  return size() == 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename concurrent_map<Key, T, Hash, KeyEqual>::size_type
+concurrent_map<Key, T, Hash, KeyEqual>::shard_count() const noexcept {
+  return shard_count_;
+}
+
+// ключи распределены по шардам примерно поровну, запас — на неравномерность
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void concurrent_map<Key, T, Hash, KeyEqual>::reserve(size_type count) {
+  size_type per_shard = count / shard_count_ + count / shard_count_ / 8 + 1;
+  for (size_type s = 0; s < shard_count_; ++s) {
+    std::unique_lock<std::shared_mutex> lock(shards_[s].mutex);
+    shards_[s].map.reserve(per_shard);
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void concurrent_map<Key, T, Hash, KeyEqual>::clear() {
+  for (size_type s = 0; s < shard_count_; ++s) {
+    std::unique_lock<std::shared_mutex> lock(shards_[s].mutex);
+    shards_[s].map.clear();
+  }
+}
+
+// шард выбирают старшие биты своего умножения: unordered_map внутри шарда
+// берёт домашнюю ячейку из старших битов другого, иначе все ключи шарда
+// попадали бы в одну часть его таблицы
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename concurrent_map<Key, T, Hash, KeyEqual>::size_type
+concurrent_map<Key, T, Hash, KeyEqual>::shard_of(const Key &key) const {
+  if (shard_count_ == 1)
+    return 0;
+  std::uint64_t mixed =
+      static_cast<std::uint64_t>(hash_(key)) * 0xD6E8FEB86659FD93ull;
+  return static_cast<size_type>(mixed >> shift_);
+}
+
+// сортировка подсчётом: order — номера элементов по возрастанию шарда,
+// элементы шарда s занимают order[bounds[s], bounds[s + 1])
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename It, typename KeyOfItem>
+void concurrent_map<Key, T, Hash, KeyEqual>::group_by_shard(
+    It first, size_type count, KeyOfItem key_of, vector<size_type> &order,
+    vector<size_type> &bounds) const {
+  vector<size_type> shard(count);
+  order = vector<size_type>(count);
+  bounds = vector<size_type>(shard_count_ + 1);
+  size_type *offset = bounds.begin();
+  std::fill(offset, offset + shard_count_ + 1, 0);
+  for (size_type i = 0; i < count; ++i) {
+    shard.begin()[i] = shard_of(key_of(first[i]));
+    ++offset[shard.begin()[i] + 1];
+  }
+  for (size_type s = 0; s < shard_count_; ++s)
+    offset[s + 1] += offset[s];
+  vector<size_type> next(shard_count_);
+  std::copy(offset, offset + shard_count_, next.begin());
+  for (size_type i = 0; i < count; ++i)
+    order.begin()[next.begin()[shard.begin()[i]]++] = i;
+}
+
+} // namespace s21
@@ -0,0 +1,83 @@
+#ifndef S21_CONCURRENT_MAP_H_
+#define S21_CONCURRENT_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "s21_unordered_map.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Потокобезопасный ассоциативный массив: ключи разложены по шардам, у
+// каждого шарда своя unordered_map и свой shared_mutex. Чтения одного
+// шарда идут параллельно, записи в разные шарды не мешают друг другу.
+// Итераторов нет: значения отдаются копиями, пока держится блокировка.
+// Пакетные операции раскладывают ключи по шардам и берут блокировку
+// каждого шарда один раз, по возрастанию номера шарда; одновременно
+// держится только одна блокировка, поэтому взаимных блокировок нет.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class concurrent_map {
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using size_type = std::size_t;
+
+  // число шардов округляется вверх до степени двойки
+  explicit concurrent_map(size_type shards = 64);
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+
+  std::optional<T> find(const Key &key) const;
+  bool contains(const Key &key) const;
+  bool insert(const Key &key, const T &value);
+  bool insert(Key &&key, T &&value);
+  bool insert_or_assign(const Key &key, const T &value);
+  size_type erase(const Key &key);
+  template <typename F> T compute_if_absent(const Key &key, F &&make);
+
+  // out[i] получает значение для i-го ключа или пустой optional
+  template <typename KeyIt, typename OutIt>
+  void find_many(KeyIt first, KeyIt last, OutIt out) const;
+  template <typename PairIt> size_type insert_many(PairIt first, PairIt last);
+  template <typename KeyIt> size_type erase_many(KeyIt first, KeyIt last);
+
+  // size() и empty() складывают шарды по очереди, поэтому при
+  // параллельных записях это лишь оценка
+  size_type size() const;
+  bool empty() const;
+  size_type shard_count() const noexcept;
+  void reserve(size_type count);
+  void clear();
+
+private:
+  // шард занимает целые строки кэша, чтобы мьютексы соседей не делили их
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    unordered_map<Key, T, Hash, KeyEqual> map;
+  };
+
+  std::unique_ptr<Shard[]> shards_;
+  size_type shard_count_;
+  unsigned shift_;
+  Hash hash_;
+
+  size_type shard_of(const Key &key) const;
+  template <typename It, typename KeyOfItem>
+  void group_by_shard(It first, size_type count, KeyOfItem key_of,
+                      vector<size_type> &order,
+                      vector<size_type> &bounds) const;
+};
+
+} // namespace s21
+
+#include "s21_concurrent_map.cpp"
+#endif // S21_CONCURRENT_MAP_H_
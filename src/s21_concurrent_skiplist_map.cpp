@@ -0,0 +1,412 @@
+#include "s21_concurrent_skiplist_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare>
+concurrent_skiplist_map<Key, T, Compare>::Node::Node(const Key &key,
+                                                     const T &value,
+                                                     int levels)
+    : data(key, value), height(levels), owners(2) {
+  for (int level = 0; level < levels; ++level)
+    new (links() + level) std::atomic<std::uintptr_t>(0);
+}
+
+template <typename Key, typename T, typename Compare>
+std::atomic<std::uintptr_t> *
+concurrent_skiplist_map<Key, T, Compare>::Node::links() noexcept {
+  return reinterpret_cast<std::atomic<std::uintptr_t> *>(
+      reinterpret_cast<char *>(this) + sizeof(Node));
+}
+
+template <typename Key, typename T, typename Compare>
+concurrent_skiplist_map<Key, T, Compare>::concurrent_skiplist_map()
+    : concurrent_skiplist_map(Compare()) {}
+
+template <typename Key, typename T, typename Compare>
+concurrent_skiplist_map<Key, T, Compare>::concurrent_skiplist_map(
+    const Compare &comp)
+    : comp_(comp) {
+  for (int level = 0; level < kMaxLevel; ++level)
+    head_[level].store(0, std::memory_order_relaxed);
+}
+
+// вырезанные узлы уже переданы epoch_domain, здесь удаляются только
+// оставшиеся на нижнем уровне, в том числе помеченные
+template <typename Key, typename T, typename Compare>
+concurrent_skiplist_map<Key, T, Compare>::~concurrent_skiplist_map() {
+  Node *node = node_of(head_[0].load(std::memory_order_acquire));
+  while (node) {
+    Node *next = node_of(node->links()[0].load(std::memory_order_relaxed));
+    destroy_node(node);
+    node = next;
+  }
+}
+
+/**
+ * Узел становится видимым, как только связан нижний уровень; верхние
+ * уровни только ускоряют поиск и связываются по одному. Если ключ успели
+ * удалить до конца связывания, оставшиеся уровни не связываются. Вставку и
+ * удаление считает owners: последний отпустивший узел ещё раз вырезает его
+ * из всех уровней и передаёт в epoch_domain.
+ */
+template <typename Key, typename T, typename Compare>
+bool concurrent_skiplist_map<Key, T, Compare>::insert(const Key &key,
+                                                      const T &value) {
+  epoch_domain::guard guard;
+  std::atomic<std::uintptr_t> *preds[kMaxLevel];
+  Node *succs[kMaxLevel];
+  Node *node = nullptr;
+  while (true) {
+    if (locate(key, preds, succs)) {
+      if (node)
+        destroy_node(node);
+      return false;
+    }
+    if (!node)
+      node = make_node(key, value, random_height());
+    for (int level = 0; level < node->height; ++level)
+      node->links()[level].store(reinterpret_cast<std::uintptr_t>(succs[level]),
+                                 std::memory_order_relaxed);
+    std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(succs[0]);
+    if (preds[0]->compare_exchange_strong(
+            expected, reinterpret_cast<std::uintptr_t>(node)))
+      break;
+  }
+  link_upper(node, preds, succs);
+  release(node);
+  return true;
+}
+
+// верхние уровни связываются по одному; если узел успели пометить,
+// оставшиеся уровни не нужны
+template <typename Key, typename T, typename Compare>
+void concurrent_skiplist_map<Key, T, Compare>::link_upper(
+    Node *node, std::atomic<std::uintptr_t> **preds, Node **succs) {
+  for (int level = 1; level < node->height; ++level) {
+    while (true) {
+      std::uintptr_t link = node->links()[level].load();
+      if (marked(link))
+        return;
+      std::uintptr_t succ = reinterpret_cast<std::uintptr_t>(succs[level]);
+      if (link != succ &&
+          !node->links()[level].compare_exchange_strong(link, succ))
+        continue;
+      if (preds[level]->compare_exchange_strong(
+              succ, reinterpret_cast<std::uintptr_t>(node)))
+        break;
+      locate(node->data.first, preds, succs);
+      if (succs[0] != node)
+        return; // узел уже вырезан с нижнего уровня
+    }
+  }
+}
+
+// помечаются сначала верхние ссылки, потом нижняя; удалил ключ тот, чья
+// пометка нижней ссылки прошла
+template <typename Key, typename T, typename Compare>
+bool concurrent_skiplist_map<Key, T, Compare>::erase(const Key &key) {
+  epoch_domain::guard guard;
+  std::atomic<std::uintptr_t> *preds[kMaxLevel];
+  Node *succs[kMaxLevel];
+  if (!locate(key, preds, succs))
+    return false;
+  Node *node = succs[0];
+  for (int level = node->height - 1; level > 0; --level) {
+    std::uintptr_t link = node->links()[level].load();
+    while (!marked(link) &&
+           !node->links()[level].compare_exchange_weak(link, link | 1))
+      ;
+  }
+  std::uintptr_t link = node->links()[0].load();
+  while (true) {
+    if (marked(link))
+      return false;
+    if (node->links()[0].compare_exchange_weak(link, link | 1))
+      break;
+  }
+  locate(key, preds, succs);
+  release(node);
+  return true;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::iterator
+concurrent_skiplist_map<Key, T, Compare>::find(const Key &key) const {
+  epoch_domain::guard guard;
+  Node *node = first_not_less(key);
+  if (!node || comp_(key, node->data.first))
+    return end();
+  return iterator(guard, node);
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_skiplist_map<Key, T, Compare>::contains(const Key &key) const {
+  epoch_domain::guard guard;
+  Node *node = first_not_less(key);
+  return node && !comp_(key, node->data.first);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::iterator
+concurrent_skiplist_map<Key, T, Compare>::lower_bound(const Key &key) const {
+  epoch_domain::guard guard;
+  return iterator(guard, first_not_less(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::iterator
+concurrent_skiplist_map<Key, T, Compare>::upper_bound(const Key &key) const {
+  epoch_domain::guard guard;
+  iterator it(guard, first_not_less(key));
+  if (it.node_ && !comp_(key, it.node_->data.first))
+    ++it;
+  return it;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::size_type
+concurrent_skiplist_map<Key, T, Compare>::size() const {
+  size_type count = 0;
+  for (iterator it = begin(); it != end(); ++it)
+    ++count;
+  return count;
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_skiplist_map<Key, T, Compare>::empty() const {
+  return begin() == end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::key_compare
+concurrent_skiplist_map<Key, T, Compare>::key_comp() const {
+  return comp_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::iterator
+concurrent_skiplist_map<Key, T, Compare>::begin() const {
+  epoch_domain::guard guard;
+  return iterator(
+      guard, skip_marked(node_of(head_[0].load(std::memory_order_acquire))));
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::iterator
+concurrent_skiplist_map<Key, T, Compare>::end() const {
+  return iterator();
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::Node *
+concurrent_skiplist_map<Key, T, Compare>::make_node(const Key &key,
+                                                    const T &value,
+                                                    int height) {
+  void *memory = ::operator new(
+      sizeof(Node) + height * sizeof(std::atomic<std::uintptr_t>));
+  try {
+    return new (memory) Node(key, value, height);
+  } catch (...) {
+    ::operator delete(memory);
+    throw;
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_skiplist_map<Key, T, Compare>::destroy_node(void *node) {
+  static_cast<Node *>(node)->~Node();
+  ::operator delete(node);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::Node *
+concurrent_skiplist_map<Key, T, Compare>::node_of(
+    std::uintptr_t link) noexcept {
+  return reinterpret_cast<Node *>(link & ~static_cast<std::uintptr_t>(1));
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_skiplist_map<Key, T, Compare>::marked(
+    std::uintptr_t link) noexcept {
+  return link & 1;
+}
+
+// уровень k достаётся узлу с вероятностью 2^-k
+template <typename Key, typename T, typename Compare>
+int concurrent_skiplist_map<Key, T, Compare>::random_height() {
+  thread_local std::uint64_t state =
+      0x9E3779B97F4A7C15ull ^ reinterpret_cast<std::uintptr_t>(&state);
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return 1 + __builtin_ctzll(state | (1ull << (kMaxLevel - 1)));
+}
+
+/**
+ * Поиск с вырезанием: на каждом уровне помеченные узлы на пути удаляются из
+ * цепочки. preds[i] — ссылка, после которой стоит искать на уровне i,
+ * succs[i] — первый непомеченный узел с ключом не меньше key. Если ссылку
+ * предшественника успели поменять, поиск начинается заново.
+ */
+template <typename Key, typename T, typename Compare>
+bool concurrent_skiplist_map<Key, T, Compare>::locate(
+    const Key &key, std::atomic<std::uintptr_t> **preds, Node **succs) const {
+  while (true) {
+    std::atomic<std::uintptr_t> *pred =
+        const_cast<std::atomic<std::uintptr_t> *>(head_);
+    Node *curr = nullptr;
+    bool restart = false;
+    for (int level = kMaxLevel - 1; level >= 0 && !restart; --level) {
+      curr = node_of(pred[level].load());
+      while (curr) {
+        std::uintptr_t succ = curr->links()[level].load();
+        if (marked(succ)) {
+          std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(curr);
+          if (!pred[level].compare_exchange_strong(expected, succ & ~1ull)) {
+            restart = true;
+            break;
+          }
+          curr = node_of(succ);
+          continue;
+        }
+        if (!comp_(curr->data.first, key))
+          break;
+        pred = curr->links();
+        curr = node_of(succ);
+      }
+      preds[level] = pred + level;
+      succs[level] = curr;
+    }
+    if (!restart)
+      return curr && !comp_(key, curr->data.first);
+  }
+}
+
+/**
+ * Вырезает помеченный node со всех уровней. locate останавливается на
+ * первом узле с равным ключом, а новый узел с тем же ключом может стоять
+ * на верхнем уровне перед node, поэтому на каждом уровне узлы с равным
+ * ключом просматриваются до конца. Спуск на уровень ниже идёт от последнего
+ * узла с меньшим ключом.
+ */
+template <typename Key, typename T, typename Compare>
+void concurrent_skiplist_map<Key, T, Compare>::unlink(Node *node) {
+  const Key &key = node->data.first;
+  bool restart = true;
+  while (restart) {
+    restart = false;
+    std::atomic<std::uintptr_t> *pred = head_;
+    for (int level = kMaxLevel - 1; level >= 0 && !restart; --level) {
+      std::atomic<std::uintptr_t> *scan = pred;
+      Node *curr = node_of(scan[level].load());
+      while (curr && !comp_(key, curr->data.first)) {
+        std::uintptr_t succ = curr->links()[level].load();
+        if (marked(succ)) {
+          std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(curr);
+          if (!scan[level].compare_exchange_strong(expected, succ & ~1ull)) {
+            restart = true;
+            break;
+          }
+        } else {
+          if (comp_(curr->data.first, key))
+            pred = curr->links();
+          scan = curr->links();
+        }
+        curr = node_of(succ);
+      }
+    }
+  }
+}
+
+// поиск только для чтения: помеченные узлы проходятся, но не вырезаются
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::Node *
+concurrent_skiplist_map<Key, T, Compare>::first_not_less(
+    const Key &key) const {
+  const std::atomic<std::uintptr_t> *pred = head_;
+  Node *curr = nullptr;
+  for (int level = kMaxLevel - 1; level >= 0; --level) {
+    curr = node_of(pred[level].load(std::memory_order_acquire));
+    while (curr && comp_(curr->data.first, key)) {
+      pred = curr->links();
+      curr = node_of(pred[level].load(std::memory_order_acquire));
+    }
+  }
+  return skip_marked(curr);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::Node *
+concurrent_skiplist_map<Key, T, Compare>::skip_marked(Node *node) noexcept {
+  while (node) {
+    std::uintptr_t link = node->links()[0].load(std::memory_order_acquire);
+    if (!marked(link))
+      return node;
+    node = node_of(link);
+  }
+  return nullptr;
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_skiplist_map<Key, T, Compare>::release(Node *node) {
+  if (node->owners.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    return;
+  unlink(node); // до нуля счётчик доходит только у помеченного узла
+  epoch_domain::instance().retire(node, &destroy_node);
+}
+
+template <typename Key, typename T, typename Compare>
+concurrent_skiplist_map<Key, T, Compare>::iterator::iterator()
+    : guard_(), node_(nullptr) {}
+
+template <typename Key, typename T, typename Compare>
+concurrent_skiplist_map<Key, T, Compare>::iterator::iterator(
+    const epoch_domain::guard &guard, Node *node)
+    : guard_(), node_(node) {
+  if (node_ != nullptr)
+    guard_.emplace(guard);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::iterator::reference
+concurrent_skiplist_map<Key, T, Compare>::iterator::operator*() const {
+  return node_->data;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::iterator::pointer
+concurrent_skiplist_map<Key, T, Compare>::iterator::operator->() const {
+  return &node_->data;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::iterator &
+concurrent_skiplist_map<Key, T, Compare>::iterator::operator++() {
+  node_ = skip_marked(
+      node_of(node_->links()[0].load(std::memory_order_acquire)));
+  if (node_ == nullptr)
+    guard_.reset();
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_skiplist_map<Key, T, Compare>::iterator
+concurrent_skiplist_map<Key, T, Compare>::iterator::operator++(int) {
+  iterator old = *this;
+  ++*this;
+  return old;
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_skiplist_map<Key, T, Compare>::iterator::operator==(
+    const iterator &other) const {
+  return node_ == other.node_;
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_skiplist_map<Key, T, Compare>::iterator::operator!=(
+    const iterator &other) const {
+  return node_ != other.node_;
+}
+
+} // namespace s21
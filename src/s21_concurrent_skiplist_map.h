@@ -0,0 +1,128 @@
+#ifndef S21_CONCURRENT_SKIPLIST_MAP_H_
+#define S21_CONCURRENT_SKIPLIST_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <optional>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+// Упорядоченный массив без блокировок на списке с пропусками. Вставка
+// связывает узел снизу вверх через compare_exchange; удаление помечает
+// младший бит ссылок узла, после чего любой проходящий поиск вырезает его
+// из уровней. Вырезанный узел уходит в epoch_domain и освобождается, когда
+// его больше никто не может читать.
+// Все операции можно вызывать из разных потоков одновременно. Значение
+// после вставки не меняется. Итератор держит epoch_domain::guard, поэтому
+// узел под ним не освобождается; обход идёт по возрастанию ключей и не
+// видит ключ дважды, а ключи, которые существовали всё время обхода, видит
+// обязательно. Итератор нельзя передавать в другой поток.
+// Пока итератор указывает на узел, эпоха потока закреплена и память,
+// удалённая из любой карты, не освобождается, поэтому долго хранить такие
+// итераторы нельзя. end() и итератор по умолчанию эпоху не держат.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class concurrent_skiplist_map {
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  class iterator;
+  using const_iterator = iterator;
+
+  concurrent_skiplist_map();
+  explicit concurrent_skiplist_map(const Compare &comp);
+  concurrent_skiplist_map(const concurrent_skiplist_map &) = delete;
+  concurrent_skiplist_map &operator=(const concurrent_skiplist_map &) = delete;
+  // других потоков, работающих с картой, уже быть не должно
+  ~concurrent_skiplist_map();
+
+  bool insert(const Key &key, const T &value);
+  bool erase(const Key &key);
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  iterator lower_bound(const Key &key) const;
+  iterator upper_bound(const Key &key) const;
+
+  // size() обходит весь нижний уровень
+  size_type size() const;
+  bool empty() const;
+  key_compare key_comp() const;
+
+  iterator begin() const;
+  iterator end() const;
+
+private:
+  static constexpr int kMaxLevel = 24;
+
+  // ссылки узла лежат сразу за ним: высота у каждого узла своя
+  struct alignas(std::atomic<std::uintptr_t>) Node {
+    value_type data;
+    int height;
+    // вставка и удаление; узел освобождает тот, кто отпустит его последним
+    std::atomic<int> owners;
+
+    Node(const Key &key, const T &value, int levels);
+    std::atomic<std::uintptr_t> *links() noexcept;
+  };
+
+  std::atomic<std::uintptr_t> head_[kMaxLevel];
+  Compare comp_;
+
+  static Node *make_node(const Key &key, const T &value, int height);
+  static void destroy_node(void *node);
+  static Node *node_of(std::uintptr_t link) noexcept;
+  static bool marked(std::uintptr_t link) noexcept;
+  static int random_height();
+
+  bool locate(const Key &key, std::atomic<std::uintptr_t> **preds,
+              Node **succs) const;
+  Node *first_not_less(const Key &key) const;
+  static Node *skip_marked(Node *node) noexcept;
+  void link_upper(Node *node, std::atomic<std::uintptr_t> **preds,
+                  Node **succs);
+  void unlink(Node *node);
+  void release(Node *node);
+};
+
+template <typename Key, typename T, typename Compare>
+class concurrent_skiplist_map<Key, T, Compare>::iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = concurrent_skiplist_map::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+
+  iterator();
+
+  reference operator*() const;
+  pointer operator->() const;
+
+  iterator &operator++();
+  iterator operator++(int);
+
+  bool operator==(const iterator &other) const;
+  bool operator!=(const iterator &other) const;
+
+private:
+  friend class concurrent_skiplist_map;
+  iterator(const epoch_domain::guard &guard, Node *node);
+
+  // пуст, когда node_ == nullptr
+  std::optional<epoch_domain::guard> guard_;
+  Node *node_;
+};
+
+} // namespace s21
+
+#include "s21_concurrent_skiplist_map.cpp"
+#endif // S21_CONCURRENT_SKIPLIST_MAP_H_
@@ -2,11 +2,23 @@
 #define S21_CONTAINER_H
 
 #include "s21_array.h"
+#include "s21_compact_list.h"
+#include "s21_concurrent_map.h"
+#include "s21_concurrent_skiplist_map.h"
+#include "s21_flat_map.h"
+#include "s21_flat_set.h"
+#include "s21_intrusive_list.h"
 #include "s21_list.h"
+#include "s21_lru_cache.h"
 #include "s21_map.h"
+#include "s21_persistent_map.h"
 #include "s21_queue.h"
+#include "s21_rcu_map.h"
 #include "s21_set.h"
 #include "s21_stack.h"
+#include "s21_unordered_map.h"
+#include "s21_unordered_set.h"
+#include "s21_unrolled_list.h"
 #include "s21_vector.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "s21_epoch.h"
+
+namespace s21 {
+
+inline epoch_domain::epoch_domain()
+    : epoch_(1), records_(nullptr), orphans_mutex_(), orphans_() {}
+
+// к этому моменту других потоков уже нет, всё отложенное можно удалить
+inline epoch_domain::~epoch_domain() {
+  for (Retired *it = orphans_.begin(); it != orphans_.end(); ++it)
+    it->deleter(it->ptr);
+  Record *record = records_.load(std::memory_order_acquire);
+  while (record) {
+    Record *next = record->next;
+    for (Retired *it = record->limbo.begin(); it != record->limbo.end(); ++it)
+      it->deleter(it->ptr);
+    delete record;
+    record = next;
+  }
+}
+
+inline epoch_domain &epoch_domain::instance() {
+  static epoch_domain domain;
+  return domain;
+}
+
+inline void epoch_domain::retire(void *ptr, deleter_type deleter) {
+  Record *record = local();
+  append(record->limbo,
+         Retired{ptr, deleter, epoch_.load(std::memory_order_seq_cst)});
+  if (record->limbo.size() % kCollectEvery == 0)
+    collect(record->limbo);
+}
+
+inline void epoch_domain::collect() {
+  collect(local()->limbo);
+  std::lock_guard<std::mutex> lock(orphans_mutex_);
+  collect(orphans_);
+}
+
+inline std::size_t epoch_domain::pending() { return local()->limbo.size(); }
+
+inline epoch_domain::Owner::~Owner() {
+  epoch_domain::instance().release_record(record);
+}
+
+inline epoch_domain::Record *epoch_domain::local() {
+  thread_local Owner owner{instance().acquire_record()};
+  return owner.record;
+}
+
+// ячейки не удаляются до конца программы: свободную ячейку занимает
+// следующий новый поток, иначе в список добавляется новая
+inline epoch_domain::Record *epoch_domain::acquire_record() {
+  for (Record *record = records_.load(std::memory_order_acquire); record;
+       record = record->next) {
+    bool expected = false;
+    if (record->used.compare_exchange_strong(expected, true))
+      return record;
+  }
+  Record *record = new Record();
+  record->used.store(true, std::memory_order_relaxed);
+  record->next = records_.load(std::memory_order_relaxed);
+  while (!records_.compare_exchange_weak(record->next, record))
+    ;
+  return record;
+}
+
+// отложенные узлы завершившегося потока переходят в общий список
+inline void epoch_domain::release_record(Record *record) {
+  {
+    std::lock_guard<std::mutex> lock(orphans_mutex_);
+    for (Retired *it = record->limbo.begin(); it != record->limbo.end(); ++it)
+      append(orphans_, *it);
+    collect(orphans_);
+  }
+  record->limbo.clear();
+  record->used.store(false, std::memory_order_release);
+}
+
+/**
+ * Узел, отложенный в эпоху t, удаляется, когда каждый поток в чтении
+ * записал эпоху больше t: такой поток вошёл в чтение после удаления узла
+ * из структуры и найти его не может. Если все потоки в чтении уже видели
+ * текущую эпоху, она увеличивается, чтобы следующий сбор продвинулся.
+ */
+inline void epoch_domain::collect(vector<Retired> &list) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::uint64_t current = epoch_.load(std::memory_order_seq_cst);
+  std::uint64_t oldest = static_cast<std::uint64_t>(-1);
+  for (Record *record = records_.load(std::memory_order_acquire); record;
+       record = record->next) {
+    std::uint64_t epoch = record->epoch.load(std::memory_order_acquire);
+    if (epoch && epoch < oldest)
+      oldest = epoch;
+  }
+  if (oldest >= current)
+    epoch_.compare_exchange_strong(current, current + 1);
+  Retired *out = list.begin();
+  for (Retired *it = list.begin(); it != list.end(); ++it) {
+    if (it->epoch < oldest)
+      it->deleter(it->ptr);
+    else
+      *out++ = *it;
+  }
+  list.resize(static_cast<std::size_t>(out - list.begin()));
+}
+
+// ёмкость растёт вдвое: vector::push_back добавляет по два места
+inline void epoch_domain::append(vector<Retired> &list, const Retired &item) {
+  if (list.size() == list.capacity())
+    list.reserve(list.capacity() * 2 + 16);
+  list.push_back(item);
+}
+
+inline epoch_domain::guard::guard() : record_(instance().local()) {
+  if (record_->depth++ == 0) {
+    record_->epoch.store(instance().epoch_.load(std::memory_order_acquire),
+                         std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+}
+
+inline epoch_domain::guard::guard(const guard &other) noexcept
+    : record_(other.record_) {
+  ++record_->depth;
+}
+
+inline epoch_domain::guard::~guard() {
+  if (--record_->depth == 0)
+    record_->epoch.store(0, std::memory_order_release);
+}
+
+} // namespace s21
@@ -0,0 +1,95 @@
+#ifndef S21_EPOCH_H_
+#define S21_EPOCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Освобождение памяти по эпохам для структур без блокировок. Поток входит в
+// чтение через guard: записывает в свою ячейку текущую эпоху, и пока guard
+// жив, узлы, которые он мог увидеть, не освобождаются. Удалённый из
+// структуры узел передаётся в retire() и удаляется позже, когда все
+// потоки, читавшие в момент удаления, выйдут из чтения. Вход и выход — две
+// записи и один забор, без атомарных read-modify-write.
+// Домен один на программу; ячейку поток получает при первом guard и
+// возвращает при завершении.
+class epoch_domain {
+public:
+  using deleter_type = void (*)(void *);
+
+  // guard можно вкладывать и копировать в пределах одного потока: эпоху
+  // записывает только внешний
+  class guard;
+
+
+  static epoch_domain &instance();
+
+  epoch_domain(const epoch_domain &) = delete;
+  epoch_domain &operator=(const epoch_domain &) = delete;
+  ~epoch_domain();
+
+  // ptr уже недостижим для новых читателей; удаляется через deleter
+  void retire(void *ptr, deleter_type deleter);
+  // освобождает всё, что можно, в том числе узлы завершившихся потоков
+  void collect();
+  // число отложенных узлов текущего потока
+  std::size_t pending();
+
+private:
+  struct Retired {
+    void *ptr;
+    deleter_type deleter;
+    std::uint64_t epoch;
+  };
+
+  // ячейка потока; 0 в epoch — поток вне чтения
+  struct alignas(64) Record {
+    std::atomic<std::uint64_t> epoch{0};
+    std::atomic<bool> used{false};
+    Record *next = nullptr;
+    unsigned depth = 0;
+    vector<Retired> limbo;
+  };
+
+  // отдаёт ячейку домену, когда поток завершается
+  struct Owner {
+    Record *record;
+    ~Owner();
+  };
+
+  static constexpr std::size_t kCollectEvery = 128;
+
+  std::atomic<std::uint64_t> epoch_;
+  std::atomic<Record *> records_;
+  std::mutex orphans_mutex_;
+  vector<Retired> orphans_;
+
+  epoch_domain();
+
+  Record *local();
+  Record *acquire_record();
+  void release_record(Record *record);
+  void collect(vector<Retired> &list);
+  static void append(vector<Retired> &list, const Retired &item);
+};
+
+class epoch_domain::guard {
+public:
+  guard();
+  guard(const guard &other) noexcept;
+  // оба guard принадлежат одному потоку, так что менять нечего
+  guard &operator=(const guard &) noexcept { return *this; }
+  ~guard();
+
+private:
+  Record *record_;
+};
+
+} // namespace s21
+
+#include "s21_epoch.cpp"
+#endif // S21_EPOCH_H_
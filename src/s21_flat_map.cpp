@@ -0,0 +1,478 @@
+#include "s21_flat_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare>::flat_map() : data_(), comp_() {}
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare>::flat_map(const Compare &comp)
+    : data_(), comp_(comp) {}
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare>::flat_map(std::initializer_list<value_type> init)
+    : flat_map() {
+  insert(init.begin(), init.end());
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+flat_map<Key, T, Compare>::flat_map(InputIt first, InputIt last,
+                                    const Compare &comp)
+    : flat_map(comp) {
+  insert(first, last);
+}
+
+// диапазон уже упорядочен по comp; из равных ключей остаётся первый
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+flat_map<Key, T, Compare>::flat_map(assume_sorted_t, InputIt first,
+                                    InputIt last, const Compare &comp)
+    : flat_map(comp) {
+  for (; first != last; ++first) {
+    value_type value(*first);
+    if (empty() || comp_(data_.back().first, value.first))
+      place(size(), std::move(value));
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+T &flat_map<Key, T, Compare>::at(const Key &key) {
+  iterator it = find(key);
+  if (it == end())
+    throw std::out_of_range("Key not found");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+T &flat_map<Key, T, Compare>::at(const K &key) {
+  iterator it = find(key);
+  if (it == end())
+    throw std::out_of_range("Key not found");
+  return it->second;
+}
+
+template <typename Key, typename T, typename Compare>
+T &flat_map<Key, T, Compare>::operator[](const Key &key) {
+  return try_emplace(key).first->second;
+}
+
+template <typename Key, typename T, typename Compare>
+bool flat_map<Key, T, Compare>::empty() const noexcept {
+  return data_.begin() == data_.end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::size() const noexcept {
+  return static_cast<size_type>(data_.end() - data_.begin());
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::max_size() const noexcept {
+  return size_type(-1) / sizeof(value_type);
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::reserve(size_type count) {
+  data_.reserve(count);
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::clear() {
+  data_.truncate(0);
+}
+
+// копия нужна до сдвига: value может лежать в самом массиве
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert(const value_type &value) {
+  return insert(value_type(value));
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert(value_type &&value) {
+  size_type index = lower_index(value.first);
+  if (equal_at(index, value.first))
+    return {begin() + index, false};
+  return {place(index, std::move(value)), true};
+}
+
+/**
+ * Новые элементы дописываются в конец и сортируются устойчиво, затем обе
+ * упорядоченные части сливаются, и из равных ключей остаётся первый: уже
+ * существующий или встреченный раньше в диапазоне. Всего O((n + m) log m)
+ * вместо m сдвигов массива.
+ */
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+void flat_map<Key, T, Compare>::insert(InputIt first, InputIt last) {
+  size_type old_size = size();
+  for (; first != last; ++first)
+    place(size(), value_type(*first));
+  if (size() == old_size)
+    return;
+  value_type *items = data_.begin();
+  std::stable_sort(items + old_size, data_.end(), value_less{&comp_});
+  std::inplace_merge(items, items + old_size, data_.end(),
+                     value_less{&comp_});
+  value_type *out = items;
+  for (value_type *it = items + 1; it != data_.end(); ++it) {
+    if (comp_(out->first, it->first) && ++out != it)
+      *out = std::move(*it);
+  }
+  data_.truncate(out - items + 1);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename M>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert_or_assign(const Key &key, M &&value) {
+  auto result = try_emplace(key, std::forward<M>(value));
+  if (!result.second)
+    result.first->second = std::forward<M>(value);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::try_emplace(const Key &key, Args &&...args) {
+  size_type index = lower_index(key);
+  if (equal_at(index, key))
+    return {begin() + index, false};
+  value_type value(std::piecewise_construct, std::forward_as_tuple(key),
+                   std::forward_as_tuple(std::forward<Args>(args)...));
+  return {place(index, std::move(value)), true};
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::erase(iterator pos) {
+  std::move(pos.slot_ + 1, data_.end(), pos.slot_);
+  data_.truncate(size() - 1);
+  return pos;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::erase(iterator first, iterator last) {
+  size_type removed = last - first;
+  std::move(last.slot_, data_.end(), first.slot_);
+  data_.truncate(size() - removed);
+  return first;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::erase(const Key &key) {
+  size_type index = lower_index(key);
+  if (!equal_at(index, key))
+    return 0;
+  erase(begin() + index);
+  return 1;
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::swap(flat_map &other) {
+  data_.swap(other.data_);
+  std::swap(comp_, other.comp_);
+}
+
+// ключи, которых здесь нет, переносятся перемещением, повторы остаются в
+// other; обе последовательности упорядочены, поэтому хватает одного прохода
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::merge(flat_map &other) {
+  if (this == &other)
+    return;
+  size_type old_size = size();
+  size_type index = 0;
+  value_type *keep = other.data_.begin();
+  for (value_type *it = keep; it != other.data_.end(); ++it) {
+    while (index < old_size && comp_(data_.begin()[index].first, it->first))
+      ++index;
+    if (index < old_size && !comp_(it->first, data_.begin()[index].first)) {
+      if (keep != it)
+        *keep = std::move(*it);
+      ++keep;
+    } else {
+      place(size(), std::move(*it));
+    }
+  }
+  other.data_.truncate(keep - other.data_.begin());
+  std::inplace_merge(data_.begin(), data_.begin() + old_size, data_.end(),
+                     value_less{&comp_});
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::find(const Key &key) {
+  size_type index = lower_index(key);
+  return equal_at(index, key) ? begin() + index : end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::find(const Key &key) const {
+  size_type index = lower_index(key);
+  return equal_at(index, key) ? begin() + index : end();
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::find(const K &key) {
+  size_type index = lower_index(key);
+  return equal_at(index, key) ? begin() + index : end();
+}
+
+template <typename Key, typename T, typename Compare>
+bool flat_map<Key, T, Compare>::contains(const Key &key) const {
+  return equal_at(lower_index(key), key);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+bool flat_map<Key, T, Compare>::contains(const K &key) const {
+  return equal_at(lower_index(key), key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::count(const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::lower_bound(const Key &key) {
+  return begin() + lower_index(key);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::lower_bound(const K &key) {
+  return begin() + lower_index(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::upper_bound(const Key &key) {
+  size_type index = lower_index(key);
+  return begin() + index + (equal_at(index, key) ? 1 : 0);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator,
+          typename flat_map<Key, T, Compare>::iterator>
+flat_map<Key, T, Compare>::equal_range(const Key &key) {
+  iterator first = lower_bound(key);
+  return {first, upper_bound(key)};
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::key_compare
+flat_map<Key, T, Compare>::key_comp() const {
+  return comp_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::begin() {
+  return iterator(data_.begin());
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::end() {
+  return iterator(data_.end());
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::begin() const {
+  return const_iterator(data_.begin());
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::end() const {
+  return const_iterator(data_.end());
+}
+
+/**
+ * Двоичный поиск без ветвлений: на каждом шаге отрезается половина
+ * диапазона, а выбор половины — условное присваивание, которое компилятор
+ * сводит к cmov. Число шагов зависит только от размера, поэтому
+ * предсказатель переходов не ошибается на случайных ключах.
+ */
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::lower_index(const K &key) const {
+  size_type n = size();
+  if (n == 0)
+    return 0;
+  const value_type *base = data_.begin();
+  while (n > 1) {
+    size_type half = n / 2;
+    base = comp_(base[half].first, key) ? base + half : base;
+    n -= half;
+  }
+  return static_cast<size_type>(base - data_.begin()) +
+         (comp_(base->first, key) ? 1 : 0);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+bool flat_map<Key, T, Compare>::equal_at(size_type index, const K &key) const {
+  return index < size() && !comp_(key, data_.begin()[index].first);
+}
+
+// вставляет value на позицию index; ёмкость растёт вдвое, а не на один
+// элемент, как у vector::push_back
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::place(size_type index, value_type &&value) {
+  size_type n = size();
+  if (n == data_.capacity())
+    data_.reserve(n < 8 ? 8 : n * 2);
+  data_.resize(n + 1);
+  value_type *slot = data_.begin() + n;
+  *slot = std::move(value);
+  std::rotate(data_.begin() + index, slot, slot + 1);
+  return begin() + index;
+}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped>::flat_map_iterator() : slot_(nullptr) {}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped>::flat_map_iterator(slot_type *slot)
+    : slot_(slot) {}
+
+template <typename Key, typename Mapped>
+template <typename M, typename>
+flat_map_iterator<Key, Mapped>::flat_map_iterator(
+    const flat_map_iterator<Key, M> &other)
+    : slot_(other.slot_) {}
+
+template <typename Key, typename Mapped>
+typename flat_map_iterator<Key, Mapped>::reference
+flat_map_iterator<Key, Mapped>::operator*() const {
+  return reference(slot_->first, slot_->second);
+}
+
+template <typename Key, typename Mapped>
+typename flat_map_iterator<Key, Mapped>::pointer
+flat_map_iterator<Key, Mapped>::operator->() const {
+  return pointer(**this);
+}
+
+template <typename Key, typename Mapped>
+typename flat_map_iterator<Key, Mapped>::reference
+flat_map_iterator<Key, Mapped>::operator[](difference_type n) const {
+  return *(*this + n);
+}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped> &flat_map_iterator<Key, Mapped>::operator++() {
+  ++slot_;
+  return *this;
+}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped>
+flat_map_iterator<Key, Mapped>::operator++(int) {
+  flat_map_iterator old = *this;
+  ++slot_;
+  return old;
+}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped> &flat_map_iterator<Key, Mapped>::operator--() {
+  --slot_;
+  return *this;
+}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped>
+flat_map_iterator<Key, Mapped>::operator--(int) {
+  flat_map_iterator old = *this;
+  --slot_;
+  return old;
+}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped> &
+flat_map_iterator<Key, Mapped>::operator+=(difference_type n) {
+  slot_ += n;
+  return *this;
+}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped> &
+flat_map_iterator<Key, Mapped>::operator-=(difference_type n) {
+  slot_ -= n;
+  return *this;
+}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped>
+flat_map_iterator<Key, Mapped>::operator+(difference_type n) const {
+  return flat_map_iterator(slot_ + n);
+}
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped>
+flat_map_iterator<Key, Mapped>::operator-(difference_type n) const {
+  return flat_map_iterator(slot_ - n);
+}
+
+template <typename Key, typename Mapped>
+typename flat_map_iterator<Key, Mapped>::difference_type
+flat_map_iterator<Key, Mapped>::operator-(
+    const flat_map_iterator &other) const {
+  return slot_ - other.slot_;
+}
+
+template <typename Key, typename Mapped>
+bool flat_map_iterator<Key, Mapped>::operator==(
+    const flat_map_iterator &other) const {
+  return slot_ == other.slot_;
+}
+
+template <typename Key, typename Mapped>
+bool flat_map_iterator<Key, Mapped>::operator!=(
+    const flat_map_iterator &other) const {
+  return slot_ != other.slot_;
+}
+
+template <typename Key, typename Mapped>
+bool flat_map_iterator<Key, Mapped>::operator<(
+    const flat_map_iterator &other) const {
+  return slot_ < other.slot_;
+}
+
+template <typename Key, typename Mapped>
+bool flat_map_iterator<Key, Mapped>::operator>(
+    const flat_map_iterator &other) const {
+  return slot_ > other.slot_;
+}
+
+template <typename Key, typename Mapped>
+bool flat_map_iterator<Key, Mapped>::operator<=(
+    const flat_map_iterator &other) const {
+  return slot_ <= other.slot_;
+}
+
+template <typename Key, typename Mapped>
+bool flat_map_iterator<Key, Mapped>::operator>=(
+    const flat_map_iterator &other) const {
+  return slot_ >= other.slot_;
+}
+
+} // namespace s21
@@ -0,0 +1,182 @@
+#ifndef S21_FLAT_MAP_H_
+#define S21_FLAT_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_map.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Ассоциативный массив на упорядоченном s21::vector пар: без узлов и
+// указателей, поиск — двоичный без ветвлений. Вставка и удаление одного
+// элемента сдвигают хвост, поэтому контейнер рассчитан на таблицы, которые
+// в основном читают; пачку ключей выгоднее вставлять через insert(first,
+// last), который сортирует и сливает их за один проход.
+// Итератор, как у std::flat_map, отдаёт пару ссылок (const Key &, T &):
+// ключ через него не изменить, иначе сломался бы порядок, на котором стоит
+// поиск. Любая вставка или удаление делает итераторы недействительными.
+template <typename Key, typename Mapped> class flat_map_iterator;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map {
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using iterator = flat_map_iterator<Key, T>;
+  using const_iterator = flat_map_iterator<Key, const T>;
+
+  flat_map();
+  explicit flat_map(const Compare &comp);
+  flat_map(std::initializer_list<value_type> init);
+  template <typename InputIt>
+  flat_map(InputIt first, InputIt last, const Compare &comp = Compare());
+  template <typename InputIt>
+  flat_map(assume_sorted_t, InputIt first, InputIt last,
+           const Compare &comp = Compare());
+
+  T &at(const Key &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  T &at(const K &key);
+  T &operator[](const Key &key);
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type count);
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <typename InputIt> void insert(InputIt first, InputIt last);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key &key, M &&value);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  size_type erase(const Key &key);
+  void swap(flat_map &other);
+  void merge(flat_map &other);
+
+  iterator find(const Key &key);
+  const_iterator find(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key);
+  bool contains(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key);
+  iterator upper_bound(const Key &key);
+  std::pair<iterator, iterator> equal_range(const Key &key);
+  key_compare key_comp() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+private:
+  struct value_less {
+    const Compare *comp;
+    bool operator()(const value_type &a, const value_type &b) const {
+      return (*comp)(a.first, b.first);
+    }
+  };
+
+  vector<value_type> data_;
+  Compare comp_;
+
+  template <typename K> size_type lower_index(const K &key) const;
+  template <typename K> bool equal_at(size_type index, const K &key) const;
+  iterator place(size_type index, value_type &&value);
+};
+
+// итератор произвольного доступа по парам flat_map; Mapped — T или const T
+template <typename Key, typename Mapped> class flat_map_iterator {
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::pair<Key, std::remove_const_t<Mapped>>;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::pair<const Key &, Mapped &>;
+  class pointer;
+
+  flat_map_iterator();
+  // iterator неявно превращается в const_iterator
+  template <typename M, typename = std::enable_if_t<
+                            std::is_same_v<const M, Mapped> &&
+                            !std::is_same_v<M, Mapped>>>
+  flat_map_iterator(const flat_map_iterator<Key, M> &other);
+
+  reference operator*() const;
+  pointer operator->() const;
+  reference operator[](difference_type n) const;
+
+  flat_map_iterator &operator++();
+  flat_map_iterator operator++(int);
+  flat_map_iterator &operator--();
+  flat_map_iterator operator--(int);
+  flat_map_iterator &operator+=(difference_type n);
+  flat_map_iterator &operator-=(difference_type n);
+  flat_map_iterator operator+(difference_type n) const;
+  flat_map_iterator operator-(difference_type n) const;
+  difference_type operator-(const flat_map_iterator &other) const;
+
+  bool operator==(const flat_map_iterator &other) const;
+  bool operator!=(const flat_map_iterator &other) const;
+  bool operator<(const flat_map_iterator &other) const;
+  bool operator>(const flat_map_iterator &other) const;
+  bool operator<=(const flat_map_iterator &other) const;
+  bool operator>=(const flat_map_iterator &other) const;
+
+private:
+  template <typename, typename, typename> friend class flat_map;
+  template <typename, typename> friend class flat_map_iterator;
+  using slot_type = std::conditional_t<std::is_const_v<Mapped>,
+                                       const value_type, value_type>;
+
+  explicit flat_map_iterator(slot_type *slot);
+
+  slot_type *slot_;
+};
+
+// пара ссылок живёт внутри, чтобы it->second указывал на значение в массиве
+template <typename Key, typename Mapped>
+class flat_map_iterator<Key, Mapped>::pointer {
+public:
+  const reference *operator->() const { return &ref_; }
+
+private:
+  friend class flat_map_iterator;
+  explicit pointer(reference ref) : ref_(ref) {}
+
+  reference ref_;
+};
+
+template <typename Key, typename Mapped>
+flat_map_iterator<Key, Mapped>
+operator+(typename flat_map_iterator<Key, Mapped>::difference_type n,
+          const flat_map_iterator<Key, Mapped> &it) {
+  return it + n;
+}
+
+} // namespace s21
+
+#include "s21_flat_map.cpp"
+#endif // S21_FLAT_MAP_H_
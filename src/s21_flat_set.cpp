@@ -0,0 +1,255 @@
+#include "s21_flat_set.h"
+
+namespace s21 {
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare>::flat_set() : data_(), comp_() {}
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare>::flat_set(const Compare &comp) : data_(), comp_(comp) {}
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare>::flat_set(std::initializer_list<value_type> init)
+    : flat_set() {
+  insert(init.begin(), init.end());
+}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+flat_set<Key, Compare>::flat_set(InputIt first, InputIt last,
+                                 const Compare &comp)
+    : flat_set(comp) {
+  insert(first, last);
+}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+flat_set<Key, Compare>::flat_set(assume_sorted_t, InputIt first, InputIt last,
+                                 const Compare &comp)
+    : flat_set(comp) {
+  for (; first != last; ++first) {
+    value_type value(*first);
+    if (empty() || comp_(data_.back(), value))
+      place(size(), std::move(value));
+  }
+}
+
+template <typename Key, typename Compare>
+bool flat_set<Key, Compare>::empty() const noexcept {
+  return data_.begin() == data_.end();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type
+flat_set<Key, Compare>::size() const noexcept {
+  return static_cast<size_type>(data_.end() - data_.begin());
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type
+flat_set<Key, Compare>::max_size() const noexcept {
+  return size_type(-1) / sizeof(value_type);
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::reserve(size_type count) {
+  data_.reserve(count);
+}
+
+template <typename Key, typename Compare> void flat_set<Key, Compare>::clear() {
+  data_.truncate(0);
+}
+
+template <typename Key, typename Compare>
+std::pair<typename flat_set<Key, Compare>::iterator, bool>
+flat_set<Key, Compare>::insert(const value_type &value) {
+  return insert(value_type(value));
+}
+
+template <typename Key, typename Compare>
+std::pair<typename flat_set<Key, Compare>::iterator, bool>
+flat_set<Key, Compare>::insert(value_type &&value) {
+  size_type index = lower_index(value);
+  if (equal_at(index, value))
+    return {begin() + index, false};
+  return {place(index, std::move(value)), true};
+}
+
+// как flat_map::insert(first, last): дописать, отсортировать, слить и
+// оставить первый из равных
+template <typename Key, typename Compare>
+template <typename InputIt>
+void flat_set<Key, Compare>::insert(InputIt first, InputIt last) {
+  size_type old_size = size();
+  for (; first != last; ++first)
+    place(size(), value_type(*first));
+  if (size() == old_size)
+    return;
+  Key *base = data_.begin();
+  std::stable_sort(base + old_size, data_.end(), comp_);
+  std::inplace_merge(base, base + old_size, data_.end(), comp_);
+  Key *out = base;
+  for (Key *it = base + 1; it != data_.end(); ++it) {
+    if (comp_(*out, *it) && ++out != it)
+      *out = std::move(*it);
+  }
+  data_.truncate(out - base + 1);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator
+flat_set<Key, Compare>::erase(iterator pos) {
+  return erase(pos, pos + 1);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator
+flat_set<Key, Compare>::erase(iterator first, iterator last) {
+  Key *base = data_.begin();
+  size_type index = first - base;
+  size_type removed = last - first;
+  std::move(base + index + removed, data_.end(), base + index);
+  data_.truncate(size() - removed);
+  return begin() + index;
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type
+flat_set<Key, Compare>::erase(const Key &key) {
+  size_type index = lower_index(key);
+  if (!equal_at(index, key))
+    return 0;
+  erase(begin() + index);
+  return 1;
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::swap(flat_set &other) {
+  data_.swap(other.data_);
+  std::swap(comp_, other.comp_);
+}
+
+// ключи, которых здесь нет, переносятся, повторы остаются в other
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::merge(flat_set &other) {
+  if (this == &other)
+    return;
+  size_type old_size = size();
+  size_type index = 0;
+  Key *keep = other.data_.begin();
+  for (Key *it = other.data_.begin(); it != other.data_.end(); ++it) {
+    while (index < old_size && comp_(data_.begin()[index], *it))
+      ++index;
+    if (index < old_size && !comp_(*it, data_.begin()[index])) {
+      if (keep != it)
+        *keep = std::move(*it);
+      ++keep;
+    } else {
+      place(size(), std::move(*it));
+    }
+  }
+  other.data_.truncate(keep - other.data_.begin());
+  Key *base = data_.begin();
+  std::inplace_merge(base, base + old_size, data_.end(), comp_);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator
+flat_set<Key, Compare>::find(const Key &key) const {
+  size_type index = lower_index(key);
+  return equal_at(index, key) ? begin() + index : end();
+}
+
+template <typename Key, typename Compare>
+template <typename K, typename C, typename>
+typename flat_set<Key, Compare>::iterator
+flat_set<Key, Compare>::find(const K &key) const {
+  size_type index = lower_index(key);
+  return equal_at(index, key) ? begin() + index : end();
+}
+
+template <typename Key, typename Compare>
+bool flat_set<Key, Compare>::contains(const Key &key) const {
+  return equal_at(lower_index(key), key);
+}
+
+template <typename Key, typename Compare>
+template <typename K, typename C, typename>
+bool flat_set<Key, Compare>::contains(const K &key) const {
+  return equal_at(lower_index(key), key);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type
+flat_set<Key, Compare>::count(const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator
+flat_set<Key, Compare>::lower_bound(const Key &key) const {
+  return begin() + lower_index(key);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator
+flat_set<Key, Compare>::upper_bound(const Key &key) const {
+  size_type index = lower_index(key);
+  return begin() + index + (equal_at(index, key) ? 1 : 0);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::key_compare
+flat_set<Key, Compare>::key_comp() const {
+  return comp_;
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator
+flat_set<Key, Compare>::begin() const {
+  return data_.begin();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::end() const {
+  return data_.end();
+}
+
+// двоичный поиск без ветвлений, см. flat_map::lower_index
+template <typename Key, typename Compare>
+template <typename K>
+typename flat_set<Key, Compare>::size_type
+flat_set<Key, Compare>::lower_index(const K &key) const {
+  size_type n = size();
+  if (n == 0)
+    return 0;
+  const Key *base = data_.begin();
+  while (n > 1) {
+    size_type half = n / 2;
+    base = comp_(base[half], key) ? base + half : base;
+    n -= half;
+  }
+  return static_cast<size_type>(base - data_.begin()) +
+         (comp_(*base, key) ? 1 : 0);
+}
+
+template <typename Key, typename Compare>
+template <typename K>
+bool flat_set<Key, Compare>::equal_at(size_type index, const K &key) const {
+  return index < size() && !comp_(key, data_.begin()[index]);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator
+flat_set<Key, Compare>::place(size_type index, value_type &&value) {
+  size_type n = size();
+  if (n == data_.capacity())
+    data_.reserve(n < 8 ? 8 : n * 2);
+  data_.resize(n + 1);
+  Key *base = data_.begin();
+  base[n] = std::move(value);
+  std::rotate(base + index, base + n, base + n + 1);
+  return base + index;
+}
+
+} // namespace s21
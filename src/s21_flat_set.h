@@ -0,0 +1,78 @@
+#ifndef S21_FLAT_SET_H_
+#define S21_FLAT_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_map.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Множество на упорядоченном s21::vector: то же устройство, что у flat_map,
+// но без отображаемых значений. Итераторы константные и становятся
+// недействительными после любой вставки или удаления.
+template <typename Key, typename Compare = std::less<Key>> class flat_set {
+public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using iterator = const Key *;
+  using const_iterator = const Key *;
+
+  flat_set();
+  explicit flat_set(const Compare &comp);
+  flat_set(std::initializer_list<value_type> init);
+  template <typename InputIt>
+  flat_set(InputIt first, InputIt last, const Compare &comp = Compare());
+  template <typename InputIt>
+  flat_set(assume_sorted_t, InputIt first, InputIt last,
+           const Compare &comp = Compare());
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type count);
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <typename InputIt> void insert(InputIt first, InputIt last);
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  size_type erase(const Key &key);
+  void swap(flat_set &other);
+  void merge(flat_set &other);
+
+  iterator find(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const;
+  bool contains(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const;
+  size_type count(const Key &key) const;
+  iterator lower_bound(const Key &key) const;
+  iterator upper_bound(const Key &key) const;
+  key_compare key_comp() const;
+
+  iterator begin() const;
+  iterator end() const;
+
+private:
+  vector<Key> data_;
+  Compare comp_;
+
+  template <typename K> size_type lower_index(const K &key) const;
+  template <typename K> bool equal_at(size_type index, const K &key) const;
+  iterator place(size_type index, value_type &&value);
+};
+
+} // namespace s21
+
+#include "s21_flat_set.cpp"
+#endif // S21_FLAT_SET_H_
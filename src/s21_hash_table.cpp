@@ -0,0 +1,448 @@
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::hash_table()
+    : ctrl_(nullptr), slots_(nullptr), capacity_(0), size_(0), shift_(64),
+      hash_(), equal_() {}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::hash_table(
+    const Hash &hash, const KeyEqual &equal)
+    : hash_table() {
+  hash_ = hash;
+  equal_ = equal;
+}
+
+// копия повторяет раскладку other: хеши те же, ячейки тоже
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::hash_table(
+    const hash_table &other)
+    : hash_table() {
+  hash_ = other.hash_;
+  equal_ = other.equal_;
+  if (!other.size_)
+    return;
+  allocate(other.capacity_);
+  try {
+    for (size_type i = other.first(); i != other.capacity_; i = other.next(i)) {
+      new (slots_ + i) Value(other.slots_[i]);
+      set_ctrl(i, other.ctrl_[i]);
+      ++size_;
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::hash_table(
+    hash_table &&other) noexcept
+    : hash_table() {
+  swap(other);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::~hash_table() {
+  release();
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+hash_table<Value, Key, KeyOf, Hash, KeyEqual> &
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::operator=(
+    const hash_table &other) {
+  if (this != &other) {
+    hash_table copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+hash_table<Value, Key, KeyOf, Hash, KeyEqual> &
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::operator=(
+    hash_table &&other) noexcept {
+  if (this != &other) {
+    release();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size() const noexcept {
+  return size_;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::capacity() const noexcept {
+  return capacity_;
+}
+
+// тег берёт 7 бит хеша под битами домашней ячейки, поэтому ёмкость не
+// больше 2^57
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::max_size() const noexcept {
+  size_type by_memory = static_cast<size_type>(-1) / 2 / sizeof(Value);
+  size_type by_tag = static_cast<size_type>(1) << 56;
+  return by_memory < by_tag ? by_memory : by_tag;
+}
+
+// clear() оставляет массивы для повторного заполнения
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void hash_table<Value, Key, KeyOf, Hash, KeyEqual>::clear() {
+  if (!capacity_)
+    return;
+  for (size_type i = first(); i != capacity_; i = next(i))
+    slots_[i].~Value();
+  std::memset(ctrl_, static_cast<unsigned char>(kEmpty),
+              capacity_ + kGroup - 1);
+  size_ = 0;
+}
+
+// после reserve(count) вставка count элементов не перестраивает таблицу
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void hash_table<Value, Key, KeyOf, Hash, KeyEqual>::reserve(size_type count) {
+  if (count > max_size())
+    throw std::length_error("hash_table::reserve");
+  size_type capacity = kGroup;
+  while (capacity - capacity / 8 < count)
+    capacity *= 2;
+  if (capacity > capacity_)
+    rehash(capacity);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void hash_table<Value, Key, KeyOf, Hash, KeyEqual>::swap(
+    hash_table &other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(shift_, other.shift_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename K>
+typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::find(const K &key) const {
+  if (!size_)
+    return npos;
+  return probe(key, mix(hash_(key)));
+}
+
+/**
+ * Ключ ищется, пока не встретится группа со свободной ячейкой: удаление
+ * не оставляет дыр между домашней ячейкой и элементом, так что дальше
+ * свободной ячейки равного ключа быть не может. Если таблицу нужно
+ * расширить, значение сначала собирается во временный объект: args могут
+ * ссылаться на элементы этой же таблицы.
+ */
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename K, typename... Args>
+std::pair<typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type,
+          bool>
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::emplace_key(const K &key,
+                                                           Args &&...args) {
+  std::uint64_t mixed = mix(hash_(key));
+  if (size_) {
+    size_type found = probe(key, mixed);
+    if (found != npos)
+      return {found, false};
+  }
+  size_type index;
+  if (size_ + 1 > capacity_ - capacity_ / 8) {
+    Value value(std::forward<Args>(args)...);
+    rehash(capacity_ ? capacity_ * 2 : kGroup);
+    index = free_slot(mixed);
+    new (slots_ + index) Value(std::move(value));
+  } else {
+    index = free_slot(mixed);
+    new (slots_ + index) Value(std::forward<Args>(args)...);
+  }
+  set_ctrl(index, tag(mixed));
+  ++size_;
+  return {index, true};
+}
+
+// сдвиг назад: элемент за дырой переезжает в неё, если от этого путь от его
+// домашней ячейки не обрывается (как в lru_cache::erase_slot)
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void hash_table<Value, Key, KeyOf, Hash, KeyEqual>::erase_at(size_type index) {
+  size_type mask = capacity_ - 1;
+  slots_[index].~Value();
+  size_type hole = index;
+  for (size_type i = (index + 1) & mask; ctrl_[i] != kEmpty;
+       i = (i + 1) & mask) {
+    size_type target = home(mix(hash_(KeyOf()(slots_[i]))));
+    if (((i - target) & mask) >= ((i - hole) & mask)) {
+      new (slots_ + hole) Value(std::move(slots_[i]));
+      slots_[i].~Value();
+      set_ctrl(hole, ctrl_[i]);
+      hole = i;
+    }
+  }
+  set_ctrl(hole, kEmpty);
+  --size_;
+}
+
+// после erase_at в ячейку может приехать следующий элемент цепочки
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+bool hash_table<Value, Key, KeyOf, Hash, KeyEqual>::occupied(
+    size_type index) const noexcept {
+  return ctrl_[index] != kEmpty;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+const Hash &
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::hash_function() const noexcept {
+  return hash_;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+const KeyEqual &
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::key_eq() const noexcept {
+  return equal_;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::first() const noexcept {
+  return capacity_ ? (ctrl_[0] != kEmpty ? 0 : next(0)) : 0;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::next(
+    size_type index) const noexcept {
+  do {
+    ++index;
+  } while (index < capacity_ && ctrl_[index] == kEmpty);
+  return index;
+}
+
+// фибоначчиево перемешивание: std::hash<int> — тождественная функция
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+std::uint64_t
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::mix(size_t hash) const noexcept {
+  return static_cast<std::uint64_t>(hash) * 11400714819323198485ull;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::home(
+    std::uint64_t mixed) const noexcept {
+  return static_cast<size_type>(mixed >> shift_);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+std::int8_t
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::tag(
+    std::uint64_t mixed) const noexcept {
+  return static_cast<std::int8_t>((mixed >> (shift_ - 7)) & 0x7F);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename K>
+typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::probe(
+    const K &key, std::uint64_t mixed) const {
+  size_type mask = capacity_ - 1;
+  size_type pos = home(mixed);
+  std::int8_t wanted = tag(mixed);
+  while (true) {
+    Group group(ctrl_ + pos);
+    for (std::uint32_t bits = group.match(wanted); bits; bits &= bits - 1) {
+      size_type index = (pos + __builtin_ctz(bits)) & mask;
+      if (equal_(KeyOf()(slots_[index]), key))
+        return index;
+    }
+    if (group.match_empty())
+      return npos;
+    pos = (pos + kGroup) & mask;
+  }
+}
+
+// первая свободная ячейка начиная с домашней
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename hash_table<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+hash_table<Value, Key, KeyOf, Hash, KeyEqual>::free_slot(
+    std::uint64_t mixed) const noexcept {
+  size_type mask = capacity_ - 1;
+  size_type pos = home(mixed);
+  while (true) {
+    if (std::uint32_t bits = Group(ctrl_ + pos).match_empty())
+      return (pos + __builtin_ctz(bits)) & mask;
+    pos = (pos + kGroup) & mask;
+  }
+}
+
+// первые kGroup - 1 байтов повторяются за концом массива, чтобы группу у
+// конца таблицы можно было прочитать одной загрузкой
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void hash_table<Value, Key, KeyOf, Hash, KeyEqual>::set_ctrl(
+    size_type index, std::int8_t value) noexcept {
+  ctrl_[index] = value;
+  if (index < kGroup - 1)
+    ctrl_[capacity_ + index] = value;
+}
+
+// place строит значение в свободной ячейке для хеша mixed; места хватает
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename... Args>
+void hash_table<Value, Key, KeyOf, Hash, KeyEqual>::place(std::uint64_t mixed,
+                                                          Args &&...args) {
+  size_type index = free_slot(mixed);
+  new (slots_ + index) Value(std::forward<Args>(args)...);
+  set_ctrl(index, tag(mixed));
+  ++size_;
+}
+
+/**
+ * Новые массивы заполняются в отдельной таблице и меняются местами с
+ * текущими только в конце, поэтому исключение оставляет таблицу прежней.
+ * Если перемещение Value может бросить, элементы копируются (как
+ * move_if_noexcept у std::vector), и старые остаются нетронутыми. Если
+ * бросить может хеш, все хеши считаются до первого перемещения. Для типа
+ * только с бросающим перемещением, как и у std::vector, гарантий нет.
+ */
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void hash_table<Value, Key, KeyOf, Hash, KeyEqual>::rehash(size_type capacity) {
+  hash_table fresh(hash_, equal_);
+  fresh.allocate(capacity);
+  if constexpr (kCopyOnRehash) {
+    for (size_type i = first(); i != capacity_; i = next(i))
+      fresh.place(mix(hash_(KeyOf()(slots_[i]))), slots_[i]);
+  } else if constexpr (kNothrowHash) {
+    for (size_type i = first(); i != capacity_; i = next(i))
+      fresh.place(mix(hash_(KeyOf()(slots_[i]))), std::move(slots_[i]));
+  } else {
+    std::unique_ptr<std::uint64_t[]> mixed(new std::uint64_t[size_]);
+    size_type n = 0;
+    for (size_type i = first(); i != capacity_; i = next(i))
+      mixed[n++] = mix(hash_(KeyOf()(slots_[i])));
+    n = 0;
+    for (size_type i = first(); i != capacity_; i = next(i))
+      fresh.place(mixed[n++], std::move(slots_[i]));
+  }
+  swap(fresh);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void hash_table<Value, Key, KeyOf, Hash, KeyEqual>::allocate(
+    size_type capacity) {
+  std::int8_t *ctrl = new std::int8_t[capacity + kGroup - 1];
+  try {
+    slots_ = std::allocator<Value>().allocate(capacity);
+  } catch (...) {
+    delete[] ctrl;
+    throw;
+  }
+  ctrl_ = ctrl;
+  std::memset(ctrl_, static_cast<unsigned char>(kEmpty),
+              capacity + kGroup - 1);
+  capacity_ = capacity;
+  size_ = 0;
+  shift_ = 64;
+  for (size_type c = capacity; c > 1; c /= 2)
+    --shift_;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void hash_table<Value, Key, KeyOf, Hash, KeyEqual>::release() noexcept {
+  if (!capacity_)
+    return;
+  for (size_type i = first(); i != capacity_; i = next(i))
+    slots_[i].~Value();
+  delete[] ctrl_;
+  std::allocator<Value>().deallocate(slots_, capacity_);
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  size_ = 0;
+  shift_ = 64;
+}
+
+template <typename Table, typename Ref>
+hash_iterator<Table, Ref>::hash_iterator(Table *table, size_type index)
+    : table_(table), index_(index) {}
+
+template <typename Table, typename Ref>
+Ref hash_iterator<Table, Ref>::operator*() const {
+  return table_->slot(index_);
+}
+
+template <typename Table, typename Ref>
+typename hash_iterator<Table, Ref>::pointer
+hash_iterator<Table, Ref>::operator->() const {
+  return &table_->slot(index_);
+}
+
+template <typename Table, typename Ref>
+hash_iterator<Table, Ref> &hash_iterator<Table, Ref>::operator++() {
+  index_ = table_->next(index_);
+  return *this;
+}
+
+template <typename Table, typename Ref>
+hash_iterator<Table, Ref> hash_iterator<Table, Ref>::operator++(int) {
+  hash_iterator old = *this;
+  ++*this;
+  return old;
+}
+
+template <typename Table, typename Ref>
+bool hash_iterator<Table, Ref>::operator==(const hash_iterator &other) const {
+  return index_ == other.index_;
+}
+
+template <typename Table, typename Ref>
+bool hash_iterator<Table, Ref>::operator!=(const hash_iterator &other) const {
+  return index_ != other.index_;
+}
+
+template <typename Table, typename Ref>
+typename hash_iterator<Table, Ref>::size_type
+hash_iterator<Table, Ref>::index() const {
+  return index_;
+}
+
+} // namespace s21
@@ -0,0 +1,159 @@
+#ifndef S21_HASH_TABLE_H_
+#define S21_HASH_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+// Общая часть unordered_map и unordered_set: хеш-таблица с открытой
+// адресацией и линейным пробированием. Рядом с массивом значений лежит
+// массив управляющих байтов: kEmpty для свободной ячейки или 7 бит хеша
+// (тег) для занятой. Поиск сравнивает тег сразу с 16 байтами (SSE2) и
+// трогает ключи только у совпавших ячеек. Удаление сдвигает хвост цепочки
+// назад, поэтому надгробий нет и длина поиска не растёт от удалений.
+// KeyOf достаёт ключ из хранимого значения.
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+class hash_table {
+public:
+  using size_type = std::size_t;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  hash_table();
+  hash_table(const Hash &hash, const KeyEqual &equal);
+  hash_table(const hash_table &other);
+  hash_table(hash_table &&other) noexcept;
+  ~hash_table();
+
+  hash_table &operator=(const hash_table &other);
+  hash_table &operator=(hash_table &&other) noexcept;
+
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+  size_type max_size() const noexcept;
+  void clear();
+  void reserve(size_type count);
+  void swap(hash_table &other) noexcept;
+
+  // индекс ячейки с ключом или npos
+  template <typename K> size_type find(const K &key) const;
+  // Value строится из args, только если key ещё нет
+  template <typename K, typename... Args>
+  std::pair<size_type, bool> emplace_key(const K &key, Args &&...args);
+  void erase_at(size_type index);
+  bool occupied(size_type index) const noexcept;
+  const Hash &hash_function() const noexcept;
+  const KeyEqual &key_eq() const noexcept;
+
+  Value &slot(size_type index) { return slots_[index]; }
+  const Value &slot(size_type index) const { return slots_[index]; }
+  // обход занятых ячеек; конец обхода — capacity()
+  size_type first() const noexcept;
+  size_type next(size_type index) const noexcept;
+
+private:
+  static constexpr size_type kGroup = 16;
+  static constexpr std::int8_t kEmpty = -128;
+  // rehash переносит элементы перемещением, только если оно не бросает, и
+  // считает хеши заранее, если может бросить хеш
+  static constexpr bool kCopyOnRehash =
+      !std::is_nothrow_move_constructible<Value>::value &&
+      std::is_copy_constructible<Value>::value;
+  static constexpr bool kNothrowHash =
+      noexcept(std::declval<const Hash &>()(std::declval<const Key &>()));
+
+  // 16 управляющих байтов, прочитанных одной загрузкой; биты масок
+  // соответствуют ячейкам группы
+  struct Group {
+#ifdef __SSE2__
+    explicit Group(const std::int8_t *ctrl)
+        : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+    std::uint32_t match(std::int8_t tag) const {
+      return static_cast<std::uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(tag))));
+    }
+    std::uint32_t match_empty() const {
+      return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+    }
+    __m128i bytes;
+#else
+    explicit Group(const std::int8_t *ctrl) {
+      std::memcpy(bytes, ctrl, kGroup);
+    }
+    std::uint32_t match(std::int8_t tag) const {
+      std::uint32_t mask = 0;
+      for (size_type i = 0; i < kGroup; ++i)
+        mask |= static_cast<std::uint32_t>(bytes[i] == tag) << i;
+      return mask;
+    }
+    std::uint32_t match_empty() const { return match(kEmpty); }
+    std::int8_t bytes[kGroup];
+#endif
+  };
+
+  std::int8_t *ctrl_; // capacity_ + kGroup - 1 байт, хвост повторяет начало
+  Value *slots_;
+  size_type capacity_;
+  size_type size_;
+  unsigned shift_;
+  Hash hash_;
+  KeyEqual equal_;
+
+  std::uint64_t mix(size_t hash) const noexcept;
+  size_type home(std::uint64_t mixed) const noexcept;
+  template <typename K>
+  size_type probe(const K &key, std::uint64_t mixed) const;
+  std::int8_t tag(std::uint64_t mixed) const noexcept;
+  void set_ctrl(size_type index, std::int8_t value) noexcept;
+  size_type free_slot(std::uint64_t mixed) const noexcept;
+  template <typename... Args>
+  void place(std::uint64_t mixed, Args &&...args);
+  void rehash(size_type capacity);
+  void allocate(size_type capacity);
+  void release() noexcept;
+};
+
+// прямой итератор по занятым ячейкам hash_table; Table может быть const,
+// тогда Ref — константная ссылка
+template <typename Table, typename Ref> class hash_iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::remove_reference_t<Ref>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type *;
+  using reference = Ref;
+  using size_type = std::size_t;
+
+  hash_iterator(Table *table = nullptr, size_type index = 0);
+
+  Ref operator*() const;
+  pointer operator->() const;
+
+  hash_iterator &operator++();
+  hash_iterator operator++(int);
+
+  bool operator==(const hash_iterator &other) const;
+  bool operator!=(const hash_iterator &other) const;
+  size_type index() const;
+
+private:
+  Table *table_;
+  size_type index_;
+};
+
+} // namespace s21
+
+#include "s21_hash_table.cpp"
+#endif // S21_HASH_TABLE_H_
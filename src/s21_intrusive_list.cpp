@@ -0,0 +1,281 @@
+#include "s21_intrusive_list.h"
+
+namespace s21 {
+
+// Итераторы
+template <typename T, intrusive_list_hook T::*Hook>
+T &intrusive_list<T, Hook>::Iterator::operator*() const {
+  return *owner(node_);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+T *intrusive_list<T, Hook>::Iterator::operator->() const {
+  return owner(node_);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::Iterator &
+intrusive_list<T, Hook>::Iterator::operator++() {
+  node_ = node_->next;
+  return *this;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::Iterator &
+intrusive_list<T, Hook>::Iterator::operator--() {
+  node_ = node_->prev;
+  return *this;
+} // --end() указывает на последний элемент
+
+template <typename T, intrusive_list_hook T::*Hook>
+bool intrusive_list<T, Hook>::Iterator::operator==(
+    const Iterator &other) const {
+  return node_ == other.node_;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+bool intrusive_list<T, Hook>::Iterator::operator!=(
+    const Iterator &other) const {
+  return node_ != other.node_;
+}
+
+// методы intrusive_list
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list() noexcept : length(0) {
+  root_.next = root_.prev = &root_;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list(intrusive_list &&other) noexcept
+    : intrusive_list() {
+  take(other);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::~intrusive_list() {
+  clear();
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook> &
+intrusive_list<T, Hook>::operator=(intrusive_list &&other) noexcept {
+  if (this != &other) {
+    clear();
+    take(other);
+  }
+  return *this;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+T &intrusive_list<T, Hook>::front() {
+  return *owner(root_.next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+T &intrusive_list<T, Hook>::back() {
+  return *owner(root_.prev);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::Iterator
+intrusive_list<T, Hook>::begin() noexcept {
+  return Iterator(root_.next);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::Iterator
+intrusive_list<T, Hook>::end() noexcept {
+  return Iterator(&root_);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::Iterator
+intrusive_list<T, Hook>::iterator_to(T &value) noexcept {
+  return Iterator(&(value.*Hook));
+} // iterator_to(): итератор по ссылке на элемент, без поиска
+
+template <typename T, intrusive_list_hook T::*Hook>
+bool intrusive_list<T, Hook>::empty() const noexcept {
+  return length == 0;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+size_t intrusive_list<T, Hook>::size() const noexcept {
+  return length;
+}
+
+// clear отцепляет элементы, чтобы их можно было снова вставить
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::clear() noexcept {
+  intrusive_list_hook *hook = root_.next;
+  while (hook != &root_) {
+    intrusive_list_hook *next = hook->next;
+    hook->next = hook->prev = nullptr;
+    hook = next;
+  }
+  root_.next = root_.prev = &root_;
+  length = 0;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::Iterator
+intrusive_list<T, Hook>::insert(Iterator pos, T &value) {
+  intrusive_list_hook *hook = &(value.*Hook);
+#if S21_INTRUSIVE_SAFE_MODE
+  if (hook->is_linked())
+    throw std::logic_error("element is already linked into a list");
+#endif
+  link(pos.node_, hook, hook);
+  ++length;
+  return Iterator(hook);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::erase(Iterator pos) noexcept(
+    !S21_INTRUSIVE_SAFE_MODE) {
+  intrusive_list_hook *hook = pos.node_;
+#if S21_INTRUSIVE_SAFE_MODE
+  if (!hook->is_linked())
+    throw std::logic_error("element is not linked into a list");
+#endif
+  unlink(hook, hook);
+  hook->next = hook->prev = nullptr;
+  --length;
+}
+
+// erase(value) — O(1), соседи берутся из хука самого элемента
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::erase(T &value) noexcept(
+    !S21_INTRUSIVE_SAFE_MODE) {
+  erase(iterator_to(value));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_back(T &value) {
+  insert(end(), value);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_back() {
+  if (length)
+    erase(Iterator(root_.prev));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_front(T &value) {
+  insert(begin(), value);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_front() {
+  if (!length)
+    throw std::out_of_range("pop_front() called on empty list");
+  erase(begin());
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list &other) noexcept {
+  intrusive_list temp;
+  temp.take(other);
+  other.take(*this);
+  take(temp);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(Iterator pos,
+                                     intrusive_list &other) noexcept {
+  if (this == &other || other.empty())
+    return;
+  intrusive_list_hook *first = other.root_.next;
+  intrusive_list_hook *last = other.root_.prev;
+  unlink(first, last);
+  link(pos.node_, first, last);
+  length += other.length;
+  other.length = 0;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(Iterator pos, intrusive_list &other,
+                                     Iterator it) noexcept {
+  intrusive_list_hook *hook = it.node_;
+  if (this == &other && (hook == pos.node_ || hook->next == pos.node_))
+    return;
+  unlink(hook, hook);
+  link(pos.node_, hook, hook);
+  --other.length;
+  ++length;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(Iterator pos, intrusive_list &other,
+                                     Iterator first, Iterator last) noexcept {
+  if (first == last)
+    return;
+  intrusive_list_hook *from = first.node_;
+  intrusive_list_hook *to = last.node_->prev;
+  if (this != &other) {
+    size_t count = 1;
+    for (intrusive_list_hook *hook = from; hook != to; hook = hook->next)
+      ++count;
+    other.length -= count;
+    length += count;
+  }
+  unlink(from, to);
+  link(pos.node_, from, to);
+}
+
+/**
+ * Смещение хука внутри T считается во время выполнения: из указателя на член,
+ * пришедшего параметром шаблона, стандартный C++ константу не получает
+ * (offsetof требует имя члена). Берётся адрес члена в неактивном члене
+ * локального union, сам T не создаётся и статической памяти не занимает;
+ * при оптимизации выражение сворачивается в константу.
+ */
+template <typename T, intrusive_list_hook T::*Hook>
+T *intrusive_list<T, Hook>::owner(intrusive_list_hook *hook) noexcept {
+  union Probe {
+    Probe() {}
+    ~Probe() {}
+    T object;
+  } probe;
+  std::ptrdiff_t offset =
+      reinterpret_cast<unsigned char *>(&(probe.object.*Hook)) -
+      reinterpret_cast<unsigned char *>(&probe);
+  return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(hook) -
+                               offset);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::link(intrusive_list_hook *pos,
+                                   intrusive_list_hook *first,
+                                   intrusive_list_hook *last) noexcept {
+  intrusive_list_hook *prev = pos->prev;
+  first->prev = prev;
+  last->next = pos;
+  prev->next = first;
+  pos->prev = last;
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::unlink(intrusive_list_hook *first,
+                                     intrusive_list_hook *last) noexcept {
+  first->prev->next = last->next;
+  last->next->prev = first->prev;
+}
+
+// take забирает элементы other; сам список должен быть пуст
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::take(intrusive_list &other) noexcept {
+  if (other.empty())
+    return;
+  root_.next = other.root_.next;
+  root_.prev = other.root_.prev;
+  root_.next->prev = &root_;
+  root_.prev->next = &root_;
+  length = other.length;
+  other.root_.next = other.root_.prev = &other.root_;
+  other.length = 0;
+}
+
+} // namespace s21
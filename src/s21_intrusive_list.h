@@ -0,0 +1,102 @@
+#ifndef S21_INTRUSIVE_LIST_H_
+#define S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+
+// В отладочной сборке хуки проверяют повторную вставку элемента и удаление
+// элемента, который ни в один список не вставлен; erase тогда может бросить
+#ifndef S21_INTRUSIVE_SAFE_MODE
+#ifdef NDEBUG
+#define S21_INTRUSIVE_SAFE_MODE 0
+#else
+#define S21_INTRUSIVE_SAFE_MODE 1
+#endif
+#endif
+
+namespace s21 {
+// Звенья списка, встроенные в сам элемент. Копия элемента получает свободный
+// хук: связи принадлежат объекту, а не значению.
+class intrusive_list_hook {
+public:
+  intrusive_list_hook() noexcept : next(nullptr), prev(nullptr) {}
+  intrusive_list_hook(const intrusive_list_hook &) noexcept
+      : next(nullptr), prev(nullptr) {}
+  intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept {
+    return *this;
+  }
+
+  bool is_linked() const noexcept { return next != nullptr; }
+
+  intrusive_list_hook *next;
+  intrusive_list_hook *prev;
+};
+
+template <typename T, intrusive_list_hook T::*Hook> class intrusive_list {
+public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  class Iterator {
+  public:
+    typedef std::ptrdiff_t difference_type;
+    intrusive_list_hook *node_;
+    explicit Iterator(intrusive_list_hook *node) : node_(node){};
+    T &operator*() const;
+    T *operator->() const;
+    Iterator &operator++();
+    Iterator &operator--();
+    bool operator==(const Iterator &other) const;
+    bool operator!=(const Iterator &other) const;
+  };
+
+  intrusive_list() noexcept;
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&other) noexcept;
+  ~intrusive_list();
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&other) noexcept;
+
+  T &front();
+  T &back();
+
+  Iterator begin() noexcept;
+  Iterator end() noexcept;
+  static Iterator iterator_to(T &value) noexcept;
+
+  bool empty() const noexcept;
+  size_t size() const noexcept;
+
+  void clear() noexcept;
+  Iterator insert(Iterator pos, T &value);
+  void erase(Iterator pos) noexcept(!S21_INTRUSIVE_SAFE_MODE);
+  void erase(T &value) noexcept(!S21_INTRUSIVE_SAFE_MODE);
+  void push_back(T &value);
+  void pop_back();
+  void push_front(T &value);
+  void pop_front();
+  void swap(intrusive_list &other) noexcept;
+  void splice(Iterator pos, intrusive_list &other) noexcept;
+  void splice(Iterator pos, intrusive_list &other, Iterator it) noexcept;
+  void splice(Iterator pos, intrusive_list &other, Iterator first,
+              Iterator last) noexcept;
+
+private:
+  intrusive_list_hook root_; // next — первый элемент, prev — последний
+  size_t length;
+
+  static T *owner(intrusive_list_hook *hook) noexcept;
+  static void link(intrusive_list_hook *pos, intrusive_list_hook *first,
+                   intrusive_list_hook *last) noexcept;
+  static void unlink(intrusive_list_hook *first,
+                     intrusive_list_hook *last) noexcept;
+  void take(intrusive_list &other) noexcept;
+};
+
+} // namespace s21
+
+#include "s21_intrusive_list.cpp"
+#endif // S21_INTRUSIVE_LIST_H_
@@ -4,7 +4,7 @@ namespace s21 {
 
 // Итераторы
 template <typename T> T &List<T>::Iterator::operator*() {
-  return node_->data;
+  return as_node(node_)->data;
 } // оператор разыменования
 
 template <typename T>
@@ -15,11 +15,9 @@ typename List<T>::Iterator &List<T>::Iterator::operator++() {
 
 template <typename T>
 typename List<T>::Iterator &List<T>::Iterator::operator--() {
-  if (node_) {
-    node_ = node_->prev;
-  }
+  node_ = node_->prev;
   return *this;
-}
+} // --end() указывает на последний элемент
 
 template <typename T>
 bool List<T>::Iterator::operator==(const Iterator &other) const {
@@ -32,10 +30,10 @@ bool List<T>::Iterator::operator!=(const Iterator &other) const {
 
 // методы List
 
-template <typename T>
-List<T>::List() : head(nullptr), tail(nullptr), length(0) {}
+template <typename T> List<T>::List() : length(0) { reset_root(); }
 
 template <typename T> List<T>::List(size_t n) : List() {
+  reserve_nodes(n);
   for (size_t i = 0; i < n; ++i)
     push_back(T());
 }
@@ -52,35 +50,45 @@ template <typename T> List<T> &List<T>::operator=(List &&other) noexcept {
   }
   return *this;
 }
+template <typename T>
+List<T>::List(std::shared_ptr<pool_type> pool) : List() {
+  pool_ = std::move(pool);
+} // список берёт узлы из общего пула, например вместе с другими списками
+
 template <typename T>
 List<T>::List(const std::initializer_list<T> &items) : List() {
+  reserve_nodes(items.size());
   for (const T &value : items) {
     push_back(value);
   }
 }
 
 template <typename T> T &List<T>::front() {
-  return head->data;
+  return as_node(root_.next)->data;
 } // front(): возвращает ссылку на данные первого элемента списка.
 
-template <typename T> const T &List<T>::front() const { return head->data; }
+template <typename T> const T &List<T>::front() const {
+  return as_node(root_.next)->data;
+}
 
 // front(): возвращает ссылку на данные первого элемента списка если ссылка
 // константная.
 
 template <typename T> T &List<T>::back() {
-  return tail->data;
+  return as_node(root_.prev)->data;
 } // back(): возвращает ссылку на данные последнего элемента списка.
 
-template <typename T> const T &List<T>::back() const { return tail->data; }
+template <typename T> const T &List<T>::back() const {
+  return as_node(root_.prev)->data;
+}
 
 template <typename T> typename List<T>::Iterator List<T>::begin() {
-  return Iterator(head);
+  return Iterator(root_.next);
 } // begin(): возвращает итератор на первый элемент списка.
 template <typename T> typename List<T>::Iterator List<T>::end() {
-  return Iterator(nullptr);
+  return Iterator(&root_);
 } // end(): возвращает итератор, указывающий на элемент, следующий за последним
-  // элементом списка т.е nullptr
+  // элементом списка т.е на сторожа root_
 
 template <typename T> bool List<T>::empty() const {
   return length == 0;
@@ -102,151 +110,225 @@ template <typename T> size_t List<T>::max_size() const {
 } // max_size() const: возвращает максимально возможное количество элементов в
   // списке, исходя из доступной памяти и размера узла (Node).
 
+template <typename T> void List<T>::reserve_nodes(size_t n) {
+  pool().reserve(n);
+} // reserve_nodes(n): заранее выделяет память под n узлов одним слабом
+
+template <typename T>
+std::shared_ptr<typename List<T>::pool_type> List<T>::node_pool() {
+  pool();
+  return pool_;
+}
+
 template <typename T> void List<T>::clear() {
-  while (!empty())
-    pop_front(); // pop_front используется для удаления первого элемента из
-                 // списка
+  if (pool_)
+    pool_type::resolve(pool_);
+  if (std::is_trivially_destructible<T>::value && pool_.use_count() == 1) {
+    pool_->release(); // пул только наш: все узлы возвращаются разом
+  } else {
+    NodeBase *node = root_.next;
+    while (node != &root_) {
+      NodeBase *next = node->next;
+      destroy_node(as_node(node));
+      node = next;
+    }
+  }
+  reset_root();
+  length = 0;
 }
 /**
- * pop_front работает по принципу
- * void List<T>::pop_front() {
- * if (head) {  // Проверка, что список не пуст
- * Node* old_head = head;  // Временный указатель на текущий первый элемент
- * head = head->next;  // Перемещаем голову на следующий элемент
- * if (head)
- * head->prev = nullptr;  // Удаляем ссылку на предыдущий элемент у новой
- * головы
- * else tail = nullptr;  // Если список стал пустым, обновляем хвост delete
- * old_head;  // Удаляем первый элемент
- * --length;  // Уменьшаем длину списка
+ * Список замкнут в кольцо через сторожа root_: у первого узла prev, а у
+ * последнего next указывают на root_, у пустого списка root_ смотрит сам на
+ * себя. Поэтому вставка и удаление не разбирают случаи головы, хвоста и
+ * пустого списка:
+ * [root] <-> [1] <-> [2] <-> [3] <-> [root]
  */
 
 template <typename T> // добавляет элемент в список
 typename List<T>::Iterator List<T>::insert(Iterator pos, const T &value) {
-  Node *current = pos.node_;
-  Node *new_node = new Node(value);
-  if (current) {
-    new_node->next = current;
-    new_node->prev = current->prev;
-
-    if (current->prev) {
-      current->prev->next = new_node;
-    } else {
-      head = new_node;
-    }
-    current->prev = new_node;
-  } else {
-    push_back(value);
-    return Iterator(tail);
-  }
+  Node *new_node = create_node(value);
+  link(pos.node_, new_node, new_node);
   ++length;
   return Iterator(new_node);
-}
+} // благодаря сторожу вставка в начало, середину и конец одинакова
 
 template <typename T> void List<T>::erase(Iterator pos) {
-  Node *current = pos.node_;
-  if (current) {
-    if (current->prev)
-      current->prev->next = current->next;
-    if (current->next)
-      current->next->prev = current->prev;
-    if (current == head)
-      head = current->next;
-    if (current == tail)
-      tail = current->prev;
-    delete current;
+  NodeBase *current = pos.node_;
+  if (current != &root_) {
+    unlink(current, current);
+    destroy_node(as_node(current));
     --length;
   }
 }
 
-template <typename T>
-void List<T>::push_back(
-    const T &value) { //  push_back добавляет новый элемент в конец списка
-                      //  сохраняя структуру например:
-  // при пустом списке вызвав пушбэк(1) список будет head -> [1] <- tail а
-  // вызвав 2 3 и 4 будет head -> [1] <-> [2] <-> [3] <-> [4] <- tail
-  Node *new_node = new Node(value);
-  if (tail) {
-    tail->next = new_node;
-    new_node->prev = tail;
-    tail = new_node;
+//  push_back добавляет новый элемент в конец списка сохраняя структуру
+//  например: при пустом списке вызвав пушбэк(1) список будет [root] <-> [1]
+//  а вызвав 2 3 и 4 будет [root] <-> [1] <-> [2] <-> [3] <-> [4] <-> [root]
+template <typename T> void List<T>::push_back(const T &value) {
+  Node *new_node = create_node(value);
+  link(&root_, new_node, new_node);
+  ++length;
+}
 
-  } else {
-    head = tail = new_node;
-  }
+template <typename T> void List<T>::push_back(T &&value) {
+  Node *new_node = create_node(std::move(value));
+  link(&root_, new_node, new_node);
+  ++length;
+}
+
+template <typename T> void List<T>::push_front(T &&value) {
+  Node *new_node = create_node(std::move(value));
+  link(root_.next, new_node, new_node);
   ++length;
 }
 
 // push_front добавляет новый элемент в начало списка.
 template <typename T> void List<T>::push_front(const T &value) {
-  Node *new_node = new Node(value);
-  if (head) {
-    head->prev = new_node;
-    new_node->next = head;
-    head = new_node;
-  } else {
-    head = tail = new_node;
-  }
+  Node *new_node = create_node(value);
+  link(root_.next, new_node, new_node);
   ++length;
 }
 template <typename T> void List<T>::pop_front() {
-  if (!head) {
+  if (!length) {
     throw std::out_of_range("pop_front() called on empty list");
   }
-  Node *temp = head;
-  head = head->next;
-  if (!head) {
-    tail = nullptr;
-  } else {
-    head->prev = nullptr;
-  }
-  delete temp;
+  NodeBase *first = root_.next;
+  unlink(first, first);
+  destroy_node(as_node(first));
   length--;
 }
 
+// сторож живёт внутри объекта, поэтому после обмена крайние узлы
+// перенаправляются на новый root_
 template <typename T> void List<T>::swap(List &other) noexcept {
-  Node *temp_head = head;
-  head = other.head;
-  other.head = temp_head;
+  std::swap(root_, other.root_);
+  std::swap(length, other.length);
+  rebind_root();
+  other.rebind_root();
+  pool_.swap(other.pool_);
+}
+
+/**
+ * insert_many собирает из аргументов готовую цепочку узлов и вставляет её
+ * перед pos одним link(). Память под все узлы готовится заранее: если
+ * свободных ячеек не хватает, пул добирает их одним слабом, и новые узлы
+ * лежат в нём подряд.
+ * Если конструктор элемента бросит исключение, список не меняется.
+ */
+template <typename T>
+template <typename... Args>
+typename List<T>::Iterator List<T>::insert_many(Iterator pos,
+                                                Args &&...args) {
+  if constexpr (sizeof...(Args) == 0) {
+    return pos;
+  } else {
+    pool().prepare(sizeof...(Args));
+    NodeBase chain{nullptr, nullptr};
+    NodeBase *last = &chain;
+    auto append = [this, &last](auto &&value) {
+      Node *node = create_node(std::forward<decltype(value)>(value));
+      node->prev = last;
+      last->next = node;
+      last = node;
+    };
+    try {
+      (append(std::forward<Args>(args)), ...);
+    } catch (...) {
+      while (last != &chain) {
+        NodeBase *prev = last->prev;
+        destroy_node(as_node(last));
+        last = prev;
+      }
+      throw;
+    }
+    link(pos.node_, chain.next, last);
+    length += sizeof...(Args);
+    return Iterator(chain.next);
+  }
+}
 
-  Node *temp_tail = tail;
-  tail = other.tail;
-  other.tail = temp_tail;
+template <typename T>
+template <typename... Args>
+void List<T>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
 
-  size_t temp_length = length;
-  length = other.length;
-  other.length = temp_length;
+template <typename T>
+template <typename... Args>
+void List<T>::insert_many_front(Args &&...args) {
+  insert_many(begin(), std::forward<Args>(args)...);
 }
 
 template <typename T> void List<T>::merge(List<T> &other) {
-  if (this == &other)
+  merge(other, std::less<>());
+}
+
+// merge перецепляет узлы other в этот список без выделения памяти
+template <typename T>
+template <typename Compare>
+void List<T>::merge(List &other, Compare comp) {
+  if (this == &other || other.empty())
     return;
+  share_pool(other);
+  NodeBase *last = other.root_.prev;
+  if (length && comp(as_node(other.root_.prev)->data, back()))
+    last = root_.prev;
+  root_.prev->next = nullptr; // слияние работает с цепочками до nullptr
+  other.root_.prev->next = nullptr;
+  Node *first = merge(length ? as_node(root_.next) : nullptr,
+                      as_node(other.root_.next), comp);
+  root_.next = first;
+  first->prev = &root_;
+  root_.prev = last;
+  last->next = &root_;
+  length += other.length;
+  other.reset_root();
+  other.length = 0;
+}
 
-  auto it1 = begin();
-  auto it2 = other.begin();
-  while (it1 != end() && it2 != other.end()) {
-    if (*it2 < *it1) {
-      insert(it1, *it2);
-      ++it2;
-    } else {
-      ++it1;
-    }
-  }
-  while (it2 != other.end()) {
-    push_back(*it2);
-    ++it2;
-  }
-  other.clear();
+// splice перецепляет узлы other перед pos без копирования элементов
+template <typename T> void List<T>::splice(Iterator pos, List &other) {
+  if (this == &other || other.empty())
+    return;
+  share_pool(other);
+  NodeBase *first = other.root_.next;
+  NodeBase *last = other.root_.prev;
+  other.reset_root();
+  link(pos.node_, first, last);
+  length += other.length;
+  other.length = 0;
 }
 
-template <typename value_type>
-void List<value_type>::splice(Iterator pos, List &other) {
-  if (!other.empty()) {
-    for (Iterator it = other.begin(); it != other.end(); ++it) {
-      this->insert(pos, *it);
-    }
-    other.clear();
+template <typename T>
+void List<T>::splice(Iterator pos, List &other, Iterator it) {
+  NodeBase *node = it.node_;
+  if (node == &other.root_ ||
+      (this == &other && (node == pos.node_ || node->next == pos.node_)))
+    return;
+  share_pool(other);
+  other.unlink(node, node);
+  link(pos.node_, node, node);
+  --other.length;
+  ++length;
+}
+
+template <typename T>
+void List<T>::splice(Iterator pos, List &other, Iterator first,
+                     Iterator last) {
+  if (first == last)
+    return;
+  NodeBase *from = first.node_;
+  NodeBase *to = last.node_->prev;
+  if (this != &other) {
+    size_t count = 1;
+    for (NodeBase *node = from; node != to; node = node->next)
+      ++count; // O(k) только ради подсчёта длины
+    share_pool(other);
+    other.length -= count;
+    length += count;
   }
+  other.unlink(from, to);
+  link(pos.node_, from, to);
 }
 
 /**
@@ -260,18 +342,11 @@ void List<T>::reverse() { // переварачивает порядок спи
   if (empty()) {
     throw std::invalid_argument("empty");
   }
-  Node *current = head;
-  Node *temp = nullptr;
-
-  while (current) {
-    temp = current->prev;
-    current->prev = current->next;
-    current->next = temp;
+  NodeBase *current = &root_;
+  do { // сторож тоже разворачивается: first и last меняются местами
+    std::swap(current->prev, current->next);
     current = current->prev;
-  }
-  temp = head;
-  head = tail;
-  tail = temp;
+  } while (current != &root_);
 }
 /**
  * удаляет все дублирующиеся последовательные элементы из двусвязного списка.
@@ -282,108 +357,244 @@ template <typename T> void List<T>::unique() {
   if (empty())
     throw std::invalid_argument("empty");
 
-  Node *current = head;
-  while (current && current->next) {
-    if (current->data == current->next->data) {
+  NodeBase *current = root_.next;
+  while (current->next != &root_) {
+    if (as_node(current)->data == as_node(current->next)->data) {
 
-      Node *duplicate = current->next;
-      current->next = duplicate->next;
-
-      if (duplicate->next) {
-        duplicate->next->prev = current;
-      } else {
-        tail = current;
-      }
-      delete duplicate;
+      NodeBase *duplicate = current->next;
+      unlink(duplicate, duplicate);
+      destroy_node(as_node(duplicate));
       --length;
     } else {
       current = current->next;
     }
   }
 }
+template <typename T> size_t List<T>::remove(const T &value) {
+  auto equal = [&value](const T &element) { return element == value; };
+  return remove_nodes(equal, &value);
+}
+
+template <typename T>
+template <typename Predicate>
+size_t List<T>::remove_if(Predicate pred) {
+  return remove_nodes(pred, nullptr);
+}
+
+/**
+ * remove_nodes за один проход отцепляет подходящие узлы и сразу возвращает
+ * их в пул. Узел, данные которого лежат по адресу keep, удаляется последним:
+ * value в remove() может ссылаться на элемент этого же списка и должен
+ * дожить до последнего сравнения.
+ */
+template <typename T>
+template <typename Predicate>
+size_t List<T>::remove_nodes(Predicate &pred, const T *keep) {
+  size_t count = 0;
+  NodeBase *deferred = nullptr;
+  NodeBase *node = root_.next;
+  while (node != &root_) {
+    NodeBase *next = node->next;
+    if (pred(as_node(node)->data)) {
+      if (&as_node(node)->data == keep) {
+        deferred = node;
+      } else {
+        unlink(node, node);
+        destroy_node(as_node(node));
+        --length;
+        ++count;
+      }
+    }
+    node = next;
+  }
+  if (deferred) {
+    unlink(deferred, deferred);
+    destroy_node(as_node(deferred));
+    --length;
+    ++count;
+  }
+  return count;
+}
+
+template <typename T, typename Predicate>
+size_t erase_if(List<T> &list, Predicate pred) {
+  return list.remove_if(pred);
+}
+
 // Original list: 4 2 5 1 3
 // Sorted list : 1 2 3 4 5
 
-template <typename T> void List<T>::sort() {
+template <typename T> void List<T>::sort() { sort(std::less<>()); }
+
+/**
+ * Сортировка слиянием снизу вверх без рекурсии: bins[i] хранит уже
+ * отсортированную серию из 2^i узлов, каждый новый узел сливается с
+ * заполненными корзинами как перенос в двоичном счётчике. Память O(1),
+ * сортировка устойчива, узлы только перецепляются.
+ */
+template <typename T>
+template <typename Compare>
+void List<T>::sort(Compare comp) {
   if (length < 2)
     throw std::invalid_argument("empty");
 
-  head = merge_sort(head);
-  Node *temp = head;
-  while (temp->next) {
-    temp = temp->next;
+  Node *bins[64] = {};
+  size_t used = 0;
+  root_.prev->next = nullptr;
+  Node *node = as_node(root_.next);
+  while (node) {
+    Node *carry = node;
+    node = as_node(node->next);
+    carry->next = nullptr;
+    carry->prev = nullptr;
+    size_t i = 0;
+    for (; i < used && bins[i]; ++i) {
+      carry = merge(bins[i], carry, comp);
+      bins[i] = nullptr;
+    }
+    if (i == used)
+      ++used;
+    bins[i] = carry;
   }
-  tail = temp;
+
+  Node *result = nullptr;
+  for (size_t i = 0; i < used; ++i) {
+    if (bins[i])
+      result = merge(bins[i], result, comp);
+  }
+  root_.next = result;
+  result->prev = &root_;
+  NodeBase *last = result;
+  while (last->next)
+    last = last->next;
+  root_.prev = last;
+  last->next = &root_;
 }
 
 // метод копирует все элементы из другого списка в текущий список.
 template <typename T> void List<T>::copy(const List &other) {
-  Node *current = other.head;
-  while (current) {
-    push_back(current->data);
-    current = current->next;
+  reserve_nodes(other.length);
+  for (NodeBase *node = other.root_.next; node != &other.root_;
+       node = node->next)
+    push_back(as_node(node)->data);
+}
+
+template <typename T>
+typename List<T>::Node *List<T>::merge(Node *left, Node *right) {
+  std::less<> comp;
+  return merge(left, right, comp);
+}
+
+// слияние двух отсортированных цепочек; при равенстве первым идёт left
+template <typename T>
+template <typename Compare>
+typename List<T>::Node *List<T>::merge(Node *left, Node *right,
+                                       Compare &comp) {
+  NodeBase result{nullptr, nullptr};
+  NodeBase *last = &result;
+  while (left && right) {
+    Node *next;
+    if (comp(right->data, left->data)) {
+      next = right;
+      right = as_node(right->next);
+    } else {
+      next = left;
+      left = as_node(left->next);
+    }
+    next->prev = last;
+    last->next = next;
+    last = next;
   }
+  Node *rest = left ? left : right;
+  if (rest)
+    rest->prev = last;
+  last->next = rest;
+  if (result.next)
+    result.next->prev = nullptr;
+  return as_node(result.next);
 }
 
-template <typename T> typename List<T>::Node *List<T>::merge_sort(Node *node) {
-  if (!node || !node->next)
-    return node;
+template <typename T> void List<T>::pop_back() {
+  if (length) {
+    NodeBase *last = root_.prev;
+    unlink(last, last);
+    destroy_node(as_node(last));
+    --length;
+  }
+}
 
-  Node *middle = get_middle(node);
-  Node *half = middle->next;
-  middle->next = nullptr;
+template <typename T> List<T>::~List() { clear(); }
+
+template <typename T> typename List<T>::pool_type &List<T>::pool() {
+  if (!pool_)
+    pool_ = std::make_shared<pool_type>();
+  return pool_type::resolve(pool_);
+} // пул создаётся лениво, пустой список ничего не выделяет
 
-  return merge(merge_sort(node), merge_sort(half));
+// после share_pool узлы other можно перецеплять в этот список и обратно
+template <typename T> void List<T>::share_pool(List &other) {
+  if (!other.pool_)
+    return;
+  if (!pool_)
+    pool_ = other.pool_;
+  pool_type::resolve(other.pool_);
+  pool_type::resolve(pool_);
+  if (pool_ != other.pool_) {
+    pool_type::merge(pool_, other.pool_);
+    other.pool_ = pool_;
+  }
 }
 
 template <typename T>
-typename List<T>::Node *List<T>::merge(Node *left, Node *right) {
-  if (!left)
-    return right;
-  if (!right)
-    return left;
-
-  if (left->data < right->data) {
-    left->next = merge(left->next, right);
-    left->next->prev = left;
-    left->prev = nullptr;
-    return left;
-  } else {
-    right->next = merge(left, right->next);
-    right->next->prev = right;
-    right->prev = nullptr;
-    return right;
+template <typename... Args>
+typename List<T>::Node *List<T>::create_node(Args &&...args) {
+  Node *node = pool().allocate();
+  try {
+    new (node) Node(std::forward<Args>(args)...);
+  } catch (...) {
+    pool_->deallocate(node);
+    throw;
   }
+  return node;
+}
+
+template <typename T> void List<T>::destroy_node(Node *node) noexcept {
+  node->~Node();
+  pool_type::resolve(pool_).deallocate(node); // узел есть — есть и пул
 }
 
 template <typename T>
-typename List<T>::Node *
-List<T>::get_middle(Node *node) { // находит средний узел в связном списке.
-  if (!node)
-    return node;
+typename List<T>::Node *List<T>::as_node(NodeBase *node) noexcept {
+  return static_cast<Node *>(node);
+} // только для узлов с данными, не для сторожа
 
-  Node *slow = node;
-  Node *fast = node->next;
+// link вставляет цепочку first..last перед pos (end() — сам сторож)
+template <typename T>
+void List<T>::link(NodeBase *pos, NodeBase *first, NodeBase *last) noexcept {
+  NodeBase *prev = pos->prev;
+  first->prev = prev;
+  last->next = pos;
+  prev->next = first;
+  pos->prev = last;
+}
 
-  while (fast && fast->next) {
-    slow = slow->next;
-    fast = fast->next->next;
-  }
-  return slow;
+template <typename T>
+void List<T>::unlink(NodeBase *first, NodeBase *last) noexcept {
+  first->prev->next = last->next;
+  last->next->prev = first->prev;
 }
 
-template <typename T> void List<T>::pop_back() {
-  if (tail) {
-    Node *old_tail = tail;
-    tail = tail->prev;
-    if (tail)
-      tail->next = nullptr;
-    else
-      head = nullptr;
-    delete old_tail;
-    --length;
-  }
+template <typename T> void List<T>::reset_root() noexcept {
+  root_.next = root_.prev = &root_;
 }
 
-template <typename T> List<T>::~List() { clear(); }
+// после копирования root_ крайние узлы ещё смотрят на старого сторожа
+template <typename T> void List<T>::rebind_root() noexcept {
+  if (length) {
+    root_.next->prev = &root_;
+    root_.prev->next = &root_;
+  } else {
+    reset_root();
+  }
+}
 } // namespace s21
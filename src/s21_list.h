@@ -1,18 +1,29 @@
 #ifndef S21_LIST_H_
 #define S21_LIST_H_
 
+#include <functional>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_node_pool.h"
 
 namespace s21 {
 template <typename T> class List {
 
 public:
-  struct Node {
+  // Звенья вынесены в базу: сторож root_ хранит только их, без данных
+  struct NodeBase {
+    NodeBase *next;
+    NodeBase *prev;
+  };
+
+  struct Node : NodeBase {
     T data;
-    Node *next;
-    Node *prev;
-    Node(const T &value) : data(value), next(nullptr), prev(nullptr){};
+    Node(const T &value) : NodeBase{nullptr, nullptr}, data(value){};
+    Node(T &&value) : NodeBase{nullptr, nullptr}, data(std::move(value)){};
   };
 
 public:
@@ -20,13 +31,14 @@ public:
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using pool_type = NodePool<Node>;
 
 public:
   class Iterator {
   public:
     typedef std::ptrdiff_t difference_type;
-    Node *node_;
-    explicit Iterator(Node *node) : node_(node){};
+    NodeBase *node_;
+    explicit Iterator(NodeBase *node) : node_(node){};
     size_t max_size() const;
     T &operator*();
     Iterator &operator++();
@@ -40,6 +52,7 @@ public:
   List(std::initializer_list<T> const &items);
   List(const List &other);
   List(List &&other) noexcept;
+  explicit List(std::shared_ptr<pool_type> pool);
   ~List();
   List &operator=(List &&l) noexcept;
   static size_t node_size() { return sizeof(Node); }
@@ -56,31 +69,64 @@ public:
   size_t size() const;
   size_t max_size() const;
 
+  void reserve_nodes(size_t n);
+  std::shared_ptr<pool_type> node_pool();
+
   void clear();
   Iterator insert(Iterator pos, const T &value);
   void erase(Iterator pos);
   void push_back(const T &value);
+  void push_back(T &&value);
   void pop_back();
   void push_front(const T &value);
+  void push_front(T &&value);
   void pop_front();
   void swap(List &other) noexcept;
+  template <typename... Args>
+  Iterator insert_many(Iterator pos, Args &&...args);
+  template <typename... Args> void insert_many_back(Args &&...args);
+  template <typename... Args> void insert_many_front(Args &&...args);
+  // merge и splice перецепляют узлы без копирования, поэтому пулы обоих
+  // списков сливаются в один и остаются общими и после операции. Пул не
+  // синхронизирован: такие списки нельзя менять из разных потоков
+  // одновременно, даже если узлами они больше не обмениваются
   void merge(List &other);
+  template <typename Compare> void merge(List &other, Compare comp);
   void splice(Iterator pos, List &other);
+  void splice(Iterator pos, List &other, Iterator it);
+  void splice(Iterator pos, List &other, Iterator first, Iterator last);
   void reverse();
   void unique();
+  size_t remove(const T &value);
+  template <typename Predicate> size_t remove_if(Predicate pred);
   void sort();
+  template <typename Compare> void sort(Compare comp);
 
 public:
-  Node *head;
-  Node *tail;
+  NodeBase root_; // кольцевой сторож: next — первый узел, prev — последний
   size_t length;
+  std::shared_ptr<pool_type> pool_;
 
+  pool_type &pool();
+  void share_pool(List &other);
+  template <typename... Args> Node *create_node(Args &&...args);
+  void destroy_node(Node *node) noexcept;
+  static Node *as_node(NodeBase *node) noexcept;
+  static void link(NodeBase *pos, NodeBase *first, NodeBase *last) noexcept;
+  static void unlink(NodeBase *first, NodeBase *last) noexcept;
+  void reset_root() noexcept;
+  void rebind_root() noexcept;
   void copy(const List &other);
-  Node *merge_sort(Node *node);
+  template <typename Predicate>
+  size_t remove_nodes(Predicate &pred, const T *keep);
   Node *merge(Node *left, Node *right);
-  Node *get_middle(Node *node);
+  template <typename Compare>
+  static Node *merge(Node *left, Node *right, Compare &comp);
 };
 
+template <typename T, typename Predicate>
+size_t erase_if(List<T> &list, Predicate pred);
+
 } // namespace s21
 
 #include "s21_list.cpp"
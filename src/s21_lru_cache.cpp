@@ -0,0 +1,273 @@
+#include "s21_lru_cache.h"
+
+namespace s21 {
+
+/**
+ * Индекс рассчитан на заполнение не больше половины: ячеек — степень двойки
+ * не меньше 2 * capacity, поэтому он не растёт и не перехешируется. Узлы
+ * списка выделяются из пула заранее, так что в установившемся режиме
+ * put() переиспользует узел вытесненной записи без обращения к malloc.
+ */
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+lru_cache<Key, Value, Hash, KeyEqual>::lru_cache(size_type capacity,
+                                                 size_type max_bytes)
+    : slots_(nullptr), mask_(0), shift_(64), capacity_(capacity),
+      max_bytes_(max_bytes), bytes_(0), hits_(0), misses_(0), evictions_(0) {
+  if (capacity == 0)
+    throw std::invalid_argument("lru_cache capacity must be positive");
+  if (capacity > (static_cast<size_t>(-1) >> 2) / sizeof(Slot))
+    throw std::length_error("lru_cache capacity is too large");
+  size_t slot_count = 2;
+  while (slot_count < 2 * capacity) {
+    slot_count *= 2;
+    --shift_;
+  }
+  --shift_;
+  // пул резервируется первым: если он бросит, слотов ещё нет, а entries_
+  // уже построен и освободится сам; new Slot[] идёт последним
+  entries_.reserve_nodes(capacity);
+  slots_ = new Slot[slot_count]();
+  mask_ = slot_count - 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+lru_cache<Key, Value, Hash, KeyEqual>::~lru_cache() {
+  delete[] slots_;
+}
+
+// get() перецепляет найденную запись в начало и учитывает попадание
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+Value *lru_cache<Key, Value, Hash, KeyEqual>::get(const Key &key) {
+  size_t index = find_slot(key, hash_(key));
+  node_type *node = slots_[index].node;
+  if (!node) {
+    ++misses_;
+    return nullptr;
+  }
+  ++hits_;
+  move_to_front(node);
+  return &entry(node).value;
+}
+
+// peek() не меняет порядок вытеснения и счётчики
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+Value *lru_cache<Key, Value, Hash, KeyEqual>::peek(const Key &key) {
+  node_type *node = slots_[find_slot(key, hash_(key))].node;
+  return node ? &entry(node).value : nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool lru_cache<Key, Value, Hash, KeyEqual>::contains(const Key &key) const {
+  return slots_[find_slot(key, hash_(key))].node != nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool lru_cache<Key, Value, Hash, KeyEqual>::put(const Key &key, Value value) {
+  return put(key, std::move(value), sizeof(Key) + sizeof(Value));
+}
+
+/**
+ * put() вставляет или заменяет запись и делает её самой свежей. bytes —
+ * вклад записи в ограничение max_bytes. Запись больше max_bytes целиком не
+ * помещается: старое значение по ключу удаляется, put() возвращает false.
+ * Обработчик вытеснения вызывается до удаления записи и не должен
+ * обращаться к этому же кэшу.
+ */
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool lru_cache<Key, Value, Hash, KeyEqual>::put(const Key &key, Value value,
+                                                size_type bytes) {
+  size_t hash = hash_(key);
+  size_t index = find_slot(key, hash);
+  if (max_bytes_ && bytes > max_bytes_) {
+    if (slots_[index].node)
+      remove(index, false);
+    return false;
+  }
+  if (node_type *node = slots_[index].node) {
+    Entry &current = entry(node);
+    current.value = std::move(value);
+    bytes_ = bytes_ - current.bytes + bytes;
+    current.bytes = bytes;
+    move_to_front(node);
+    evict_to_fit(0, 0);
+    return true;
+  }
+  if (entries_.size() == capacity_ ||
+      (max_bytes_ && bytes_ + bytes > max_bytes_)) {
+    evict_to_fit(1, bytes);
+    index = find_slot(key, hash); // вытеснение сдвигает ячейки индекса
+  }
+  entries_.push_front(Entry{key, std::move(value), bytes, hash});
+  slots_[index] = Slot{hash, entries_.root_.next};
+  bytes_ += bytes;
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool lru_cache<Key, Value, Hash, KeyEqual>::touch(const Key &key) {
+  node_type *node = slots_[find_slot(key, hash_(key))].node;
+  if (node)
+    move_to_front(node);
+  return node != nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool lru_cache<Key, Value, Hash, KeyEqual>::erase(const Key &key) {
+  size_t index = find_slot(key, hash_(key));
+  if (!slots_[index].node)
+    return false;
+  remove(index, false);
+  return true;
+}
+
+// clear() не вызывает обработчик вытеснения и не сбрасывает счётчики
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void lru_cache<Key, Value, Hash, KeyEqual>::clear() {
+  for (size_t i = 0; i <= mask_; ++i)
+    slots_[i].node = nullptr;
+  entries_.clear();
+  bytes_ = 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void lru_cache<Key, Value, Hash, KeyEqual>::set_eviction_callback(
+    eviction_callback callback) {
+  on_evict_ = std::move(callback);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool lru_cache<Key, Value, Hash, KeyEqual>::empty() const noexcept {
+  return entries_.empty();
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t lru_cache<Key, Value, Hash, KeyEqual>::size() const noexcept {
+  return entries_.size();
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t lru_cache<Key, Value, Hash, KeyEqual>::capacity() const noexcept {
+  return capacity_;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t lru_cache<Key, Value, Hash, KeyEqual>::bytes() const noexcept {
+  return bytes_;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t lru_cache<Key, Value, Hash, KeyEqual>::max_bytes() const noexcept {
+  return max_bytes_;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t lru_cache<Key, Value, Hash, KeyEqual>::hits() const noexcept {
+  return hits_;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t lru_cache<Key, Value, Hash, KeyEqual>::misses() const noexcept {
+  return misses_;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t lru_cache<Key, Value, Hash, KeyEqual>::evictions() const noexcept {
+  return evictions_;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void lru_cache<Key, Value, Hash, KeyEqual>::reset_stats() noexcept {
+  hits_ = misses_ = evictions_ = 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename lru_cache<Key, Value, Hash, KeyEqual>::Entry &
+lru_cache<Key, Value, Hash, KeyEqual>::entry(node_type *node) {
+  return *typename list_type::Iterator(node);
+}
+
+// фибоначчиево хеширование: старшие биты произведения не зависят от того,
+// насколько плохо распределены младшие биты исходного хеша
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t lru_cache<Key, Value, Hash, KeyEqual>::home(size_t hash) const noexcept {
+  return static_cast<size_t>(
+      (static_cast<std::uint64_t>(hash) * 11400714819323198485ull) >> shift_);
+}
+
+// find_slot возвращает ячейку с ключом или свободную ячейку для вставки
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t lru_cache<Key, Value, Hash, KeyEqual>::find_slot(const Key &key,
+                                                        size_t hash) const {
+  size_t index = home(hash);
+  while (node_type *node = slots_[index].node) {
+    if (slots_[index].hash == hash && equal_(entry(node).key, key))
+      break;
+    index = (index + 1) & mask_;
+  }
+  return index;
+}
+
+// ячейка индекса для узла, который точно есть в кэше; ключи не сравниваются
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t
+lru_cache<Key, Value, Hash, KeyEqual>::slot_of(node_type *node) const noexcept {
+  size_t index = home(entry(node).hash);
+  while (slots_[index].node != node)
+    index = (index + 1) & mask_;
+  return index;
+}
+
+/**
+ * Удаление без надгробий: записи за освобождённой ячейкой сдвигаются назад,
+ * если от этого их путь от домашней ячейки не обрывается. Длина цепочек
+ * поиска не растёт от числа удалений.
+ */
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void lru_cache<Key, Value, Hash, KeyEqual>::erase_slot(size_t index) noexcept {
+  size_t next = index;
+  while (true) {
+    next = (next + 1) & mask_;
+    if (!slots_[next].node)
+      break;
+    size_t target = home(slots_[next].hash);
+    if (((next - target) & mask_) >= ((next - index) & mask_)) {
+      slots_[index] = slots_[next];
+      index = next;
+    }
+  }
+  slots_[index].node = nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void lru_cache<Key, Value, Hash, KeyEqual>::move_to_front(node_type *node) {
+  entries_.splice(entries_.begin(), entries_,
+                  typename list_type::Iterator(node));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void lru_cache<Key, Value, Hash, KeyEqual>::remove(size_t index,
+                                                   bool evicted) {
+  node_type *node = slots_[index].node;
+  Entry &current = entry(node);
+  if (evicted) {
+    ++evictions_;
+    if (on_evict_)
+      on_evict_(current.key, current.value);
+  }
+  bytes_ -= current.bytes;
+  erase_slot(index);
+  entries_.erase(typename list_type::Iterator(node));
+}
+
+// вытесняет самые старые записи, пока не поместятся incoming новых записей
+// общим размером incoming_bytes
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void lru_cache<Key, Value, Hash, KeyEqual>::evict_to_fit(
+    size_type incoming, size_type incoming_bytes) {
+  while (!entries_.empty() &&
+         (entries_.size() + incoming > capacity_ ||
+          (max_bytes_ && bytes_ + incoming_bytes > max_bytes_)))
+    remove(slot_of(entries_.root_.prev), true);
+}
+
+} // namespace s21
@@ -0,0 +1,97 @@
+#ifndef S21_LRU_CACHE_H_
+#define S21_LRU_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_list.h"
+
+namespace s21 {
+// LRU-кэш: записи лежат в List от свежих к старым, обращение перецепляет узел
+// в начало. Ключ находится через хеш-индекс с открытой адресацией, который
+// хранит указатели на узлы списка. Вытеснение идёт с конца списка, когда
+// превышено число записей или суммарный размер в байтах.
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class lru_cache {
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = size_t;
+  using eviction_callback = std::function<void(const Key &, Value &)>;
+
+  // max_bytes == 0 — без ограничения по размеру
+  explicit lru_cache(size_type capacity, size_type max_bytes = 0);
+  lru_cache(const lru_cache &) = delete;
+  lru_cache &operator=(const lru_cache &) = delete;
+  ~lru_cache();
+
+  Value *get(const Key &key);
+  Value *peek(const Key &key);
+  bool contains(const Key &key) const;
+  bool put(const Key &key, Value value);
+  bool put(const Key &key, Value value, size_type bytes);
+  bool touch(const Key &key);
+  bool erase(const Key &key);
+  void clear();
+
+  void set_eviction_callback(eviction_callback callback);
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+  size_type bytes() const noexcept;
+  size_type max_bytes() const noexcept;
+  size_type hits() const noexcept;
+  size_type misses() const noexcept;
+  size_type evictions() const noexcept;
+  void reset_stats() noexcept;
+
+private:
+  struct Entry {
+    Key key;
+    Value value;
+    size_type bytes;
+    size_t hash;
+  };
+
+  using list_type = List<Entry>;
+  using node_type = typename list_type::NodeBase;
+
+  struct Slot {
+    size_t hash;
+    node_type *node; // nullptr — ячейка свободна
+  };
+
+  list_type entries_; // начало — самые свежие записи
+  Slot *slots_;
+  size_t mask_;
+  unsigned shift_;
+  size_type capacity_;
+  size_type max_bytes_;
+  size_type bytes_;
+  size_type hits_;
+  size_type misses_;
+  size_type evictions_;
+  eviction_callback on_evict_;
+  Hash hash_;
+  KeyEqual equal_;
+
+  static Entry &entry(node_type *node);
+  size_t home(size_t hash) const noexcept;
+  size_t find_slot(const Key &key, size_t hash) const;
+  size_t slot_of(node_type *node) const noexcept;
+  void erase_slot(size_t index) noexcept;
+  void move_to_front(node_type *node);
+  void remove(size_t index, bool evicted);
+  void evict_to_fit(size_type incoming, size_type incoming_bytes);
+};
+
+} // namespace s21
+
+#include "s21_lru_cache.cpp"
+#endif // S21_LRU_CACHE_H_
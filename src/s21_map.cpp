@@ -3,46 +3,65 @@
 
 namespace s21 {
 
-template <typename Key, typename T>
-Map<Key, T>::Node::Node(const value_type &data)
-    : data(data), left(nullptr), right(nullptr), parent(nullptr) {}
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+Map<Key, T, Compare>::Node::Node(Args &&...args)
+    : data(std::forward<Args>(args)...), left(nullptr), right(nullptr),
+      parent(nullptr), size(1), red(true) {}
 
-template <typename Key, typename T>
-Map<Key, T>::Map() : root_(nullptr), size_(0) {}
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::Map() : root_(nullptr), size_(0), comp_() {}
 
-template <typename Key, typename T>
-Map<Key, T>::Map(std::initializer_list<value_type> init) : Map() {
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::Map(const Compare &comp)
+    : root_(nullptr), size_(0), comp_(comp) {}
+
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::Map(std::initializer_list<value_type> init) : Map() {
   for (const auto &item : init) {
     insert(item);
   }
 }
 
-template <typename Key, typename T> Map<Key, T>::Map(const Map &other) : Map() {
-  for (const auto &item : other) {
-    insert(item);
-  }
+/**
+ * Диапазон должен быть упорядочен по comp; из подряд идущих равных ключей
+ * остаётся первый. Дерево строится за O(n) без сравнений при спуске и без
+ * балансировки.
+ */
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+Map<Key, T, Compare>::Map(assume_sorted_t, InputIt first, InputIt last,
+                          const Compare &comp)
+    : Map(comp) {
+  build_sorted(first, last);
 }
 
-template <typename Key, typename T>
-Map<Key, T>::Map(Map &&other) noexcept : Map() {
+// копия повторяет форму и цвета узлов other за O(n), без сравнений ключей
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::Map(const Map &other) : Map(other.comp_) {
+  root_ = clone(other.root_, nullptr);
+  size_ = other.size_;
+}
+
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::Map(Map &&other) noexcept : Map() {
   swap(other);
 }
 
-template <typename Key, typename T> Map<Key, T>::~Map() { clear(); }
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::~Map() { clear(); }
 
-template <typename Key, typename T>
-Map<Key, T> &Map<Key, T>::operator=(const Map &other) {
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare> &Map<Key, T, Compare>::operator=(const Map &other) {
   if (this != &other) {
-    clear();
-    for (const auto &item : other) {
-      insert(item);
-    }
+    Map copy(other);
+    swap(copy);
   }
   return *this;
 }
 
-template <typename Key, typename T>
-Map<Key, T> &Map<Key, T>::operator=(Map &&other) noexcept {
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare> &Map<Key, T, Compare>::operator=(Map &&other) noexcept {
   if (this != &other) {
     clear();
     swap(other);
@@ -50,7 +69,16 @@ Map<Key, T> &Map<Key, T>::operator=(Map &&other) noexcept {
   return *this;
 }
 
-template <typename Key, typename T> T &Map<Key, T>::at(const Key &key) {
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+Map<Key, T, Compare> Map<Key, T, Compare>::from_sorted(InputIt first,
+                                                       InputIt last,
+                                                       const Compare &comp) {
+  return Map(assume_sorted, first, last, comp);
+}
+
+template <typename Key, typename T, typename Compare>
+T &Map<Key, T, Compare>::at(const Key &key) {
   Node *node = find(key);
   if (!node) {
     throw std::out_of_range("Key not found");
@@ -58,32 +86,52 @@ template <typename Key, typename T> T &Map<Key, T>::at(const Key &key) {
   return node->data.second;
 }
 
-template <typename Key, typename T> T &Map<Key, T>::operator[](const Key &key) {
-  auto [it, inserted] = insert({key, T()});
-  return it->second;
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+T &Map<Key, T, Compare>::at(const K &key) {
+  Node *node = find_node(key);
+  if (!node) {
+    throw std::out_of_range("Key not found");
+  }
+  return node->data.second;
+}
+
+template <typename Key, typename T, typename Compare>
+T &Map<Key, T, Compare>::operator[](const Key &key) {
+  return try_emplace(key).first->second;
 }
 
-template <typename Key, typename T> bool Map<Key, T>::empty() const noexcept {
+template <typename Key, typename T, typename Compare>
+T &Map<Key, T, Compare>::operator[](Key &&key) {
+  return try_emplace(std::move(key)).first->second;
+}
+
+template <typename Key, typename T, typename Compare>
+bool Map<Key, T, Compare>::empty() const noexcept {
   return size_ == 0;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::size_type Map<Key, T>::size() const noexcept {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::size() const noexcept {
   return size_;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::size_type Map<Key, T>::max_size() const noexcept {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::max_size() const noexcept {
   return (size_type(-1) / sizeof(Node));
 }
 
-template <typename Key, typename T> void Map<Key, T>::clear() {
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::clear() {
   clear(root_);
   root_ = nullptr;
   size_ = 0;
 }
 
-template <typename Key, typename T> void Map<Key, T>::clear(Node *node) {
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::clear(Node *node) {
   if (node) {
     clear(node->left);
     clear(node->right);
@@ -91,70 +139,420 @@ template <typename Key, typename T> void Map<Key, T>::clear(Node *node) {
   }
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool>
-Map<Key, T>::insert(const value_type &value) {
-  Node *parent = nullptr;
+// при исключении уже скопированная часть поддерева удаляется
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::Node *
+Map<Key, T, Compare>::clone(const Node *node, Node *parent) {
+  if (!node) {
+    return nullptr;
+  }
+  Node *copy = new Node(node->data);
+  copy->parent = parent;
+  copy->red = node->red;
+  copy->size = node->size;
+  try {
+    copy->left = clone(node->left, copy);
+    copy->right = clone(node->right, copy);
+  } catch (...) {
+    clear(copy);
+    throw;
+  }
+  return copy;
+}
+
+/**
+ * Первый проход собирает узлы в цепочку через right и считает их, второй
+ * раскладывает цепочку в дерево, деля её пополам. Глубины листьев такого
+ * дерева отличаются не больше чем на один: узлы глубже floor(log2(n + 1))
+ * красятся в красный, остальные чёрные, и чёрная высота везде одинакова.
+ */
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+void Map<Key, T, Compare>::build_sorted(InputIt first, InputIt last) {
+  Node *head = nullptr;
+  Node *tail = nullptr;
+  size_type count = 0;
+  try {
+    for (; first != last; ++first) {
+      const value_type &value = *first;
+      if (tail && !comp_(tail->data.first, value.first)) {
+        continue;
+      }
+      Node *node = new Node(value);
+      (tail ? tail->right : head) = node;
+      tail = node;
+      ++count;
+    }
+  } catch (...) {
+    while (head) {
+      Node *next = head->right;
+      delete head;
+      head = next;
+    }
+    throw;
+  }
+  int black_depth = 0;
+  for (size_type full = count + 1; full > 1; full /= 2) {
+    ++black_depth;
+  }
+  root_ = build_balanced(head, count, 1, black_depth);
+  if (root_) {
+    root_->parent = nullptr;
+  }
+  size_ = count;
+}
+
+// забирает из chain count узлов по порядку и возвращает корень поддерева
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::Node *
+Map<Key, T, Compare>::build_balanced(Node *&chain, size_type count, int depth,
+                                     int black_depth) {
+  if (count == 0) {
+    return nullptr;
+  }
+  size_type left_count = (count - 1) / 2;
+  Node *left = build_balanced(chain, left_count, depth + 1, black_depth);
+  Node *node = chain;
+  chain = chain->right;
+  node->left = left;
+  if (left) {
+    left->parent = node;
+  }
+  node->right = build_balanced(chain, count - 1 - left_count, depth + 1,
+                               black_depth);
+  if (node->right) {
+    node->right->parent = node;
+  }
+  node->red = depth > black_depth;
+  node->size = count;
+  return node;
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename Map<Key, T, Compare>::iterator, bool>
+Map<Key, T, Compare>::insert(const value_type &value) {
+  return emplace_key(value.first, value);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename Map<Key, T, Compare>::iterator, bool>
+Map<Key, T, Compare>::insert(value_type &&value) {
+  return emplace_key(value.first, std::move(value));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename M>
+std::pair<typename Map<Key, T, Compare>::iterator, bool>
+Map<Key, T, Compare>::insert_or_assign(const Key &key, M &&value) {
+  auto result = try_emplace(key, std::forward<M>(value));
+  if (!result.second) {
+    result.first->second = std::forward<M>(value);
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename M>
+std::pair<typename Map<Key, T, Compare>::iterator, bool>
+Map<Key, T, Compare>::insert_or_assign(Key &&key, M &&value) {
+  auto result = try_emplace(std::move(key), std::forward<M>(value));
+  if (!result.second) {
+    result.first->second = std::forward<M>(value);
+  }
+  return result;
+}
+
+/**
+ * emplace строит пару из произвольных аргументов, поэтому ключ в общем случае
+ * известен только после создания узла: при повторе узел удаляется. Для
+ * вызова emplace(key, value) с готовым Key поиск идёт до выделения памяти.
+ */
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+std::pair<typename Map<Key, T, Compare>::iterator, bool>
+Map<Key, T, Compare>::emplace(Args &&...args) {
+  if constexpr (leads_with_key<Args...>::value) {
+    auto refs = std::forward_as_tuple(args...);
+    return emplace_key(std::get<0>(refs), std::forward<Args>(args)...);
+  } else {
+    Node *node = new Node(std::forward<Args>(args)...);
+    Position pos = locate(node->data.first);
+    if (pos.found) {
+      delete node;
+      return {iterator(pos.found), false};
+    }
+    return {attach(node, pos), true};
+  }
+}
+
+// try_emplace не трогает args, если ключ уже есть
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+std::pair<typename Map<Key, T, Compare>::iterator, bool>
+Map<Key, T, Compare>::try_emplace(const Key &key, Args &&...args) {
+  return emplace_key(key, std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+std::pair<typename Map<Key, T, Compare>::iterator, bool>
+Map<Key, T, Compare>::try_emplace(Key &&key, Args &&...args) {
+  return emplace_key(key, std::piecewise_construct,
+                     std::forward_as_tuple(std::move(key)),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+// emplace_key ищет key и только при его отсутствии строит узел из args;
+// key может ссылаться на args, пока узел не создан
+template <typename Key, typename T, typename Compare>
+template <typename K, typename... Args>
+std::pair<typename Map<Key, T, Compare>::iterator, bool>
+Map<Key, T, Compare>::emplace_key(K &&key, Args &&...args) {
+  Position pos = locate(key);
+  if (pos.found) {
+    return {iterator(pos.found), false};
+  }
+  return {attach(new Node(std::forward<Args>(args)...), pos), true};
+}
+
+// спуск с одним сравнением на узел: candidate — последний узел, ключ
+// которого не больше искомого; равенство проверяется один раз в конце
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename Map<Key, T, Compare>::Position
+Map<Key, T, Compare>::locate(const K &key) const {
+  Position pos{nullptr, nullptr, false};
   Node *current = root_;
+  Node *candidate = nullptr;
   while (current) {
-    parent = current;
-    if (value.first < current->data.first) {
+    pos.parent = current;
+    pos.to_left = comp_(key, current->data.first);
+    if (pos.to_left) {
       current = current->left;
-    } else if (value.first > current->data.first) {
-      current = current->right;
     } else {
-      return {iterator(current), false};
+      candidate = current;
+      current = current->right;
     }
   }
+  if (candidate && !comp_(candidate->data.first, key)) {
+    pos.found = candidate;
+  }
+  return pos;
+}
 
-  Node *node = new Node(value);
-  node->parent = parent;
-  if (!parent) {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator
+Map<Key, T, Compare>::attach(Node *node, const Position &pos) {
+  node->left = node->right = nullptr;
+  node->parent = pos.parent;
+  node->size = 1;
+  node->red = true;
+  for (Node *up = pos.parent; up; up = up->parent)
+    ++up->size;
+  if (!pos.parent) {
     root_ = node;
-  } else if (value.first < parent->data.first) {
-    parent->left = node;
+  } else if (pos.to_left) {
+    pos.parent->left = node;
   } else {
-    parent->right = node;
+    pos.parent->right = node;
   }
+  insert_fixup(node);
   ++size_;
-  return {iterator(node), true};
+  return iterator(node);
+}
+
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::erase(iterator pos) {
+  Node *node = pos.getNode();
+  if (!node)
+    return;
+  detach(node);
+  delete node;
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool>
-Map<Key, T>::insert_or_assign(const Key &key, const T &value) {
-  auto [it, inserted] = insert({key, value});
-  if (!inserted) {
-    it->second = value;
+// index-й по порядку элемент, считая с нуля; end(), если index >= size()
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator
+Map<Key, T, Compare>::select(size_type index) const {
+  Node *current = root_;
+  while (current) {
+    size_type left = size_of(current->left);
+    if (index < left) {
+      current = current->left;
+    } else if (index == left) {
+      break;
+    } else {
+      index -= left + 1;
+      current = current->right;
+    }
   }
-  return {it, inserted};
+  return iterator(current);
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::rank(const Key &key) const {
+  return count_less(key);
 }
 
-template <typename Key, typename T> void Map<Key, T>::erase(iterator pos) {
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::rank(const K &key) const {
+  return count_less(key);
+}
+
+// число ключей строго меньше key: на спуске вправо слева остаётся
+// левое поддерево и сам узел
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::count_less(const K &key) const {
+  size_type result = 0;
+  Node *current = root_;
+  while (current) {
+    if (comp_(current->data.first, key)) {
+      result += size_of(current->left) + 1;
+      current = current->right;
+    } else {
+      current = current->left;
+    }
+  }
+  return result;
+}
+
+// число ключей в [low, high)
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::count_range(const Key &low, const Key &high) const {
+  if (!comp_(low, high))
+    return 0;
+  return count_less(high) - count_less(low);
+}
+
+/**
+ * Удаляет [first, last) и возвращает last. Удаление из красно-чёрного дерева
+ * в среднем делает O(1) поворотов, а переход к следующему узлу при обходе
+ * диапазона — O(1) амортизированно, поэтому всего O(k + log n). Размеры
+ * поддеревьев по ходу не уменьшаются до корня: завышенными остаются только
+ * узлы, чей интервал ключей накрывает удалённый диапазон, то есть путь от
+ * корня к месту перед last. Он пересчитывается один раз снизу вверх. Всё
+ * дерево освобождается через clear() без балансировки.
+ */
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator
+Map<Key, T, Compare>::erase(iterator first, iterator last) {
+  if (first == begin() && last == end()) {
+    clear();
+    return end();
+  }
+  while (first != last) {
+    Node *node = first.getNode();
+    ++first;
+    detach(node, true);
+    delete node;
+  }
+  Node *gap = last.getNode();
+  gap = !gap ? maximum(root_) : gap->left ? maximum(gap->left) : gap;
+  for (; gap; gap = gap->parent)
+    update_size(gap);
+  return last;
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::erase(const Key &key) {
+  Node *node = find_node(key);
+  if (!node)
+    return 0;
+  detach(node);
+  delete node;
+  return 1;
+}
+
+// узел отцепляется от дерева без копирования и освобождения памяти
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::node_type
+Map<Key, T, Compare>::extract(iterator pos) {
   Node *node = pos.getNode();
   if (!node)
-    return;
+    return node_type();
+  detach(node);
+  return node_type(node);
+}
 
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::node_type
+Map<Key, T, Compare>::extract(const Key &key) {
+  return extract(iterator(find_node(key)));
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::insert_return_type
+Map<Key, T, Compare>::insert(node_type &&node) {
+  if (node.empty())
+    return {end(), false, node_type()};
+  Position pos = locate(node.key());
+  if (pos.found)
+    return {iterator(pos.found), false, std::move(node)};
+  Node *raw = node.node_;
+  node.node_ = nullptr;
+  return {attach(raw, pos), true, node_type()};
+}
+
+/**
+ * Удаление как в обычном дереве поиска, но запоминается цвет узла, который
+ * фактически покинул своё место, и позиция (child, parent), куда встал его
+ * потомок. Если ушёл чёрный узел, erase_fixup восстанавливает чёрную высоту.
+ * Сам узел не освобождается, его ссылки остаются прежними. Размеры
+ * поддеревьев уменьшаются заранее на пути от места, которое физически
+ * освобождается, до корня; повороты в erase_fixup пересчитывают их сами.
+ * При deferred путь обрывается на node: выше размеры остаются на единицу
+ * больше, и их пересчитывает вызывающий.
+ */
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::detach(Node *node, bool deferred) {
+  Node *vacated = node->left && node->right ? minimum(node->right) : node;
+  Node *stop = !deferred ? nullptr : vacated == node ? node->parent : node;
+  for (Node *up = vacated->parent; up != stop; up = up->parent)
+    --up->size;
+  bool removed_red = node->red;
+  Node *child;
+  Node *parent;
   if (!node->left) {
+    child = node->right;
+    parent = node->parent;
     transplant(node, node->right);
   } else if (!node->right) {
+    child = node->left;
+    parent = node->parent;
     transplant(node, node->left);
   } else {
     Node *successor = minimum(node->right);
+    removed_red = successor->red;
+    child = successor->right;
     if (successor->parent != node) {
+      parent = successor->parent;
       transplant(successor, successor->right);
       successor->right = node->right;
       successor->right->parent = successor;
+    } else {
+      parent = successor;
     }
     transplant(node, successor);
     successor->left = node->left;
     successor->left->parent = successor;
+    successor->red = node->red;
+    successor->size = node->size;
   }
-  delete node;
   --size_;
+  if (!removed_red)
+    erase_fixup(child, parent);
 }
 
-template <typename Key, typename T> void Map<Key, T>::swap(Map &other) {
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::swap(Map &other) {
   Node *temp_root = root_;
   root_ = other.root_;
   other.root_ = temp_root;
@@ -162,59 +560,256 @@ template <typename Key, typename T> void Map<Key, T>::swap(Map &other) {
   size_t temp_size = size_;
   size_ = other.size_;
   other.size_ = temp_size;
+
+  std::swap(comp_, other.comp_);
 }
 
-template <typename Key, typename T> void Map<Key, T>::merge(Map &other) {
-  for (auto it = other.begin(); it != other.end();) {
-    insert(*it++);
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::merge(Map &other) {
+  // узлы переходят из other перецеплением; ключи, которые уже есть, остаются
+  if (this == &other)
+    return;
+  for (iterator it = other.begin(); it != other.end();) {
+    Node *node = it.getNode();
+    ++it;
+    Position pos = locate(node->data.first);
+    if (!pos.found) {
+      other.detach(node);
+      attach(node, pos);
+    }
   }
-  other.clear();
 }
 
-template <typename Key, typename T>
-bool Map<Key, T>::contains(const Key &key) const {
+template <typename Key, typename T, typename Compare>
+bool Map<Key, T, Compare>::contains(const Key &key) const {
   return find(key) != nullptr;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::begin() {
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+bool Map<Key, T, Compare>::contains(const K &key) const {
+  return find_node(key) != nullptr;
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::count(const Key &key) const {
+  return find(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::count(const K &key) const {
+  return find_node(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename KeyIt, typename OutIt>
+void Map<Key, T, Compare>::find_batch(KeyIt first, KeyIt last,
+                                      OutIt out) const {
+  find_each(first, last, [&out](Node *node) { *out++ = iterator(node); });
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename KeyIt, typename OutIt>
+void Map<Key, T, Compare>::contains_batch(KeyIt first, KeyIt last,
+                                          OutIt out) const {
+  find_each(first, last, [&out](Node *node) { *out++ = node != nullptr; });
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::key_compare
+Map<Key, T, Compare>::key_comp() const {
+  return comp_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator Map<Key, T, Compare>::begin() {
   return iterator(minimum(root_));
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::end() {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator Map<Key, T, Compare>::end() {
   return iterator(nullptr);
 }
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::begin() const {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator Map<Key, T, Compare>::begin() const {
   return iterator(minimum(root_));
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::end() const {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator Map<Key, T, Compare>::end() const {
   return iterator(nullptr);
 }
-template <typename Key, typename T>
-typename Map<Key, T>::Node *Map<Key, T>::iterator::getNode() const {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::Node *
+Map<Key, T, Compare>::iterator::getNode() const {
   return node_;
 }
-template <typename Key, typename T>
-typename Map<Key, T>::Node *Map<Key, T>::find(const Key &key) const {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::Node *
+Map<Key, T, Compare>::find(const Key &key) const {
+  return find_node(key);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename Map<Key, T, Compare>::Node *
+Map<Key, T, Compare>::find(const K &key) const {
+  return find_node(key);
+}
+
+// find_node ищет нижнюю границу ключа и один раз проверяет её на равенство
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename Map<Key, T, Compare>::Node *
+Map<Key, T, Compare>::find_node(const K &key) const {
+  Node *candidate = lower_node(key);
+  if (candidate && !comp_(key, candidate->data.first)) {
+    return candidate;
+  }
+  return nullptr;
+}
+
+/**
+ * Спуск по дереву — цепочка зависимых загрузок, и одиночный find простаивает
+ * на каждом промахе кеша. Здесь до kBatchWidth спусков идут по очереди на
+ * один шаг, а узел, в который шагнул спуск, сразу запрашивается prefetch'ем:
+ * пока обходятся остальные спуски, он успевает прийти из памяти. Когда все
+ * спуски группы дошли до листа, их узлы (или nullptr) по порядку ключей
+ * уходят в visit; глубина сбалансированного дерева почти одинакова, так что
+ * ждать отстающих почти не приходится.
+ * Шаг без ветвлений: направление на случайных ключах не предсказать.
+ */
+template <typename Key, typename T, typename Compare>
+template <typename KeyIt, typename Visit>
+void Map<Key, T, Compare>::find_each(KeyIt first, KeyIt last,
+                                     Visit visit) const {
+  struct Lane {
+    Node *current;
+    Node *candidate;
+    KeyIt key;
+  };
+  if (size_ < kBatchMinSize) {
+    for (; first != last; ++first)
+      visit(find_node(*first));
+    return;
+  }
+  Lane lanes[kBatchWidth];
+  while (first != last) {
+    size_type width = 0;
+    for (; width < kBatchWidth && first != last; ++width, ++first)
+      lanes[width] = Lane{root_, nullptr, first};
+    for (bool moving = true; moving;) {
+      moving = false;
+      for (size_type i = 0; i < width; ++i) {
+        Lane &lane = lanes[i];
+        if (Node *node = lane.current) {
+          bool less = comp_(node->data.first, *lane.key);
+          lane.candidate = less ? lane.candidate : node;
+          lane.current = less ? node->right : node->left;
+          __builtin_prefetch(lane.current);
+          moving = true;
+        }
+      }
+    }
+    for (size_type i = 0; i < width; ++i) {
+      Node *found = lanes[i].candidate;
+      visit(found && !comp_(*lanes[i].key, found->data.first) ? found
+                                                               : nullptr);
+    }
+  }
+}
+
+// первый узел с ключом не меньше key
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename Map<Key, T, Compare>::Node *
+Map<Key, T, Compare>::lower_node(const K &key) const {
   Node *current = root_;
+  Node *candidate = nullptr;
   while (current) {
-    if (key < current->data.first) {
-      current = current->left;
-    } else if (key > current->data.first) {
+    if (comp_(current->data.first, key)) {
       current = current->right;
     } else {
-      return current;
+      candidate = current;
+      current = current->left;
     }
   }
-  return nullptr;
+  return candidate;
+}
+
+// первый узел с ключом строго больше key
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename Map<Key, T, Compare>::Node *
+Map<Key, T, Compare>::upper_node(const K &key) const {
+  Node *current = root_;
+  Node *candidate = nullptr;
+  while (current) {
+    if (comp_(key, current->data.first)) {
+      candidate = current;
+      current = current->left;
+    } else {
+      current = current->right;
+    }
+  }
+  return candidate;
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator
+Map<Key, T, Compare>::lower_bound(const Key &key) const {
+  return iterator(lower_node(key));
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::transplant(Node *u, Node *v) {
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename Map<Key, T, Compare>::iterator
+Map<Key, T, Compare>::lower_bound(const K &key) const {
+  return iterator(lower_node(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator
+Map<Key, T, Compare>::upper_bound(const Key &key) const {
+  return iterator(upper_node(key));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename Map<Key, T, Compare>::iterator
+Map<Key, T, Compare>::upper_bound(const K &key) const {
+  return iterator(upper_node(key));
+}
+
+// ключи уникальны: диапазон пуст или состоит из одного узла
+template <typename Key, typename T, typename Compare>
+std::pair<typename Map<Key, T, Compare>::iterator,
+          typename Map<Key, T, Compare>::iterator>
+Map<Key, T, Compare>::equal_range(const Key &key) const {
+  iterator first(lower_node(key));
+  iterator last = first;
+  if (first != end() && !comp_(key, first->first))
+    ++last;
+  return {first, last};
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+std::pair<typename Map<Key, T, Compare>::iterator,
+          typename Map<Key, T, Compare>::iterator>
+Map<Key, T, Compare>::equal_range(const K &key) const {
+  iterator first(lower_node(key));
+  iterator last = first;
+  if (first != end() && !comp_(key, first->first))
+    ++last;
+  return {first, last};
+}
+
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::transplant(Node *u, Node *v) {
   if (!u->parent) {
     root_ = v;
   } else if (u == u->parent->left) {
@@ -227,37 +822,155 @@ void Map<Key, T>::transplant(Node *u, Node *v) {
   }
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::Node *Map<Key, T>::minimum(Node *node) {
+template <typename Key, typename T, typename Compare>
+bool Map<Key, T, Compare>::is_red(const Node *node) {
+  return node && node->red;
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::size_type
+Map<Key, T, Compare>::size_of(const Node *node) {
+  return node ? node->size : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::update_size(Node *node) {
+  node->size = 1 + size_of(node->left) + size_of(node->right);
+}
+
+/**
+ * Поворот влево вокруг node:
+ *     node               right
+ *    /    \             /     \
+ *   a    right   ->   node     c
+ *        /   \        /   \
+ *       b     c      a     b
+ */
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::rotate_left(Node *node) {
+  Node *right = node->right;
+  node->right = right->left;
+  if (right->left)
+    right->left->parent = node;
+  transplant(node, right);
+  right->left = node;
+  node->parent = right;
+  right->size = node->size;
+  update_size(node);
+}
+
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::rotate_right(Node *node) {
+  Node *left = node->left;
+  node->left = left->right;
+  if (left->right)
+    left->right->parent = node;
+  transplant(node, left);
+  left->right = node;
+  node->parent = left;
+  left->size = node->size;
+  update_size(node);
+}
+
+// новый узел красный; чиним нарушение "красный под красным" перекраской
+// вверх по дереву или одним-двумя поворотами
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::insert_fixup(Node *node) {
+  while (is_red(node->parent)) {
+    Node *parent = node->parent;
+    Node *grand = parent->parent; // есть: красный узел не бывает корнем
+    bool left_side = parent == grand->left;
+    Node *uncle = left_side ? grand->right : grand->left;
+    if (is_red(uncle)) {
+      parent->red = false;
+      uncle->red = false;
+      grand->red = true;
+      node = grand;
+      continue;
+    }
+    if (node == (left_side ? parent->right : parent->left)) {
+      node = parent;
+      left_side ? rotate_left(node) : rotate_right(node);
+      parent = node->parent;
+    }
+    parent->red = false;
+    grand->red = true;
+    left_side ? rotate_right(grand) : rotate_left(grand);
+  }
+  root_->red = false;
+}
+
+// на месте node (может быть nullptr) не хватает одного чёрного узла
+template <typename Key, typename T, typename Compare>
+void Map<Key, T, Compare>::erase_fixup(Node *node, Node *parent) {
+  while (node != root_ && !is_red(node)) {
+    bool left_side = node == parent->left;
+    Node *sibling = left_side ? parent->right : parent->left;
+    if (sibling->red) {
+      sibling->red = false;
+      parent->red = true;
+      left_side ? rotate_left(parent) : rotate_right(parent);
+      sibling = left_side ? parent->right : parent->left;
+    }
+    Node *near = left_side ? sibling->left : sibling->right;
+    Node *far = left_side ? sibling->right : sibling->left;
+    if (!is_red(near) && !is_red(far)) {
+      sibling->red = true;
+      node = parent;
+      parent = node->parent;
+      continue;
+    }
+    if (!is_red(far)) {
+      near->red = false;
+      sibling->red = true;
+      left_side ? rotate_right(sibling) : rotate_left(sibling);
+      sibling = left_side ? parent->right : parent->left;
+      far = left_side ? sibling->right : sibling->left;
+    }
+    sibling->red = parent->red;
+    parent->red = false;
+    far->red = false;
+    left_side ? rotate_left(parent) : rotate_right(parent);
+    node = root_;
+  }
+  if (node)
+    node->red = false;
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::Node *Map<Key, T, Compare>::minimum(Node *node) {
   while (node && node->left) {
     node = node->left;
   }
   return node;
 }
 
-template <typename Key, typename T>
-Map<Key, T>::iterator::iterator(Node *node) : node_(node) {}
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::iterator::iterator(Node *node) : node_(node) {}
 
-template <typename Key, typename T>
-typename Map<Key, T>::value_type &Map<Key, T>::iterator::operator*() const {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::value_type &
+Map<Key, T, Compare>::iterator::operator*() const {
   return node_->data;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::value_type *Map<Key, T>::iterator::operator->() const {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::value_type *
+Map<Key, T, Compare>::iterator::operator->() const {
   return &(node_->data);
 }
-template <typename Key, typename T>
-bool Map<Key, T>::iterator::operator==(const Node *node) const {
+template <typename Key, typename T, typename Compare>
+bool Map<Key, T, Compare>::iterator::operator==(const Node *node) const {
   return node_ == node;
 }
 
-template <typename Key, typename T>
-bool Map<Key, T>::iterator::operator!=(const Node *node) const {
+template <typename Key, typename T, typename Compare>
+bool Map<Key, T, Compare>::iterator::operator!=(const Node *node) const {
   return node_ != node;
 }
-template <typename Key, typename T>
-typename Map<Key, T>::iterator &Map<Key, T>::iterator::operator++() {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator &
+Map<Key, T, Compare>::iterator::operator++() {
   if (node_) {
     if (node_->right) {
       node_ = minimum(node_->right);
@@ -273,21 +986,23 @@ typename Map<Key, T>::iterator &Map<Key, T>::iterator::operator++() {
   return *this;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::iterator::operator++(int) {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator
+Map<Key, T, Compare>::iterator::operator++(int) {
   iterator tmp(*this);
   ++(*this);
   return tmp;
 }
-template <typename Key, typename T>
-typename Map<Key, T>::Node *Map<Key, T>::maximum(Node *node) {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::Node *Map<Key, T, Compare>::maximum(Node *node) {
   while (node && node->right) {
     node = node->right;
   }
   return node;
 }
-template <typename Key, typename T>
-typename Map<Key, T>::iterator &Map<Key, T>::iterator::operator--() {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator &
+Map<Key, T, Compare>::iterator::operator--() {
   if (node_) {
     if (node_->left) {
       node_ = maximum(node_->left);
@@ -303,20 +1018,70 @@ typename Map<Key, T>::iterator &Map<Key, T>::iterator::operator--() {
   return *this;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::iterator::operator--(int) {
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::iterator
+Map<Key, T, Compare>::iterator::operator--(int) {
   iterator tmp(*this);
   --(*this);
   return tmp;
 }
 
-template <typename Key, typename T>
-bool Map<Key, T>::iterator::operator==(const iterator &other) const {
+template <typename Key, typename T, typename Compare>
+bool Map<Key, T, Compare>::iterator::operator==(const iterator &other) const {
   return node_ == other.node_;
 }
-template <typename Key, typename T>
-bool Map<Key, T>::iterator::operator!=(const iterator &other) const {
+template <typename Key, typename T, typename Compare>
+bool Map<Key, T, Compare>::iterator::operator!=(const iterator &other) const {
   return node_ != other.node_;
 }
 
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::node_type::node_type() noexcept : node_(nullptr) {}
+
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::node_type::node_type(Node *node) noexcept
+    : node_(node) {}
+
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::node_type::node_type(node_type &&other) noexcept
+    : node_(other.node_) {
+  other.node_ = nullptr;
+}
+
+template <typename Key, typename T, typename Compare>
+typename Map<Key, T, Compare>::node_type &
+Map<Key, T, Compare>::node_type::operator=(node_type &&other) noexcept {
+  if (this != &other) {
+    delete node_;
+    node_ = other.node_;
+    other.node_ = nullptr;
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::node_type::~node_type() {
+  delete node_;
+}
+
+template <typename Key, typename T, typename Compare>
+bool Map<Key, T, Compare>::node_type::empty() const noexcept {
+  return node_ == nullptr;
+}
+
+template <typename Key, typename T, typename Compare>
+Map<Key, T, Compare>::node_type::operator bool() const noexcept {
+  return node_ != nullptr;
+}
+
+template <typename Key, typename T, typename Compare>
+const Key &Map<Key, T, Compare>::node_type::key() const {
+  return node_->data.first;
+}
+
+template <typename Key, typename T, typename Compare>
+T &Map<Key, T, Compare>::node_type::mapped() const {
+  return node_->data.second;
+}
+
 } // namespace s21
@@ -1,21 +1,46 @@
 #ifndef S21_MAP_H
 #define S21_MAP_H
 
+#include <functional>
 #include <initializer_list>
+#include <limits>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace s21 {
 
-template <typename Key, typename T> class Map {
+// метка для конструкторов из диапазона, уже упорядоченного по ключу
+struct assume_sorted_t {
+  explicit assume_sorted_t() = default;
+};
+inline constexpr assume_sorted_t assume_sorted{};
+
+// Compare — строгий порядок на ключах, на узел приходится одно сравнение.
+// Если у Compare есть is_transparent (например std::less<>), find, contains,
+// at и count принимают любой сравнимый с Key тип без построения Key.
+// try_emplace, operator[] и insert_or_assign создают узел только после того,
+// как поиск убедился, что ключа нет; значение строится прямо в узле.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class Map {
 public:
+  using key_type = Key;
+  using mapped_type = T;
   using value_type = std::pair<const Key, T>;
   using size_type = std::size_t;
+  using key_compare = Compare;
 
   class iterator;
+  class node_type;
+  struct insert_return_type;
 
   Map();
+  explicit Map(const Compare &comp);
   Map(std::initializer_list<value_type> init);
+  template <typename InputIt>
+  Map(assume_sorted_t, InputIt first, InputIt last,
+      const Compare &comp = Compare());
   Map(const Map &other);
   Map(Map &&other) noexcept;
   ~Map();
@@ -23,8 +48,16 @@ public:
   Map &operator=(const Map &other);
   Map &operator=(Map &&other) noexcept;
 
+  template <typename InputIt>
+  static Map from_sorted(InputIt first, InputIt last,
+                         const Compare &comp = Compare());
+
   T &at(const Key &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  T &at(const K &key);
   T &operator[](const Key &key);
+  T &operator[](Key &&key);
 
   bool empty() const noexcept;
   size_type size() const noexcept;
@@ -32,12 +65,62 @@ public:
 
   void clear();
   std::pair<iterator, bool> insert(const value_type &value);
-  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key &key, M &&value);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(Key &&key, M &&value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+  insert_return_type insert(node_type &&node);
   void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  size_type erase(const Key &key);
+  node_type extract(iterator pos);
+  node_type extract(const Key &key);
   void swap(Map &other);
   void merge(Map &other);
 
   bool contains(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const;
+  size_type count(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K &key) const;
+  // в out по порядку ключей пишется итератор на ключ или end(); несколько
+  // поисков идут в ногу, и следующий узел каждого подгружается заранее.
+  // KeyIt — прямой итератор, OutIt — любой итератор вывода
+  template <typename KeyIt, typename OutIt>
+  void find_batch(KeyIt first, KeyIt last, OutIt out) const;
+  template <typename KeyIt, typename OutIt>
+  void contains_batch(KeyIt first, KeyIt last, OutIt out) const;
+  key_compare key_comp() const;
+
+  iterator lower_bound(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const;
+  iterator upper_bound(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const;
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) const;
+
+  iterator select(size_type index) const;
+  size_type rank(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type rank(const K &key) const;
+  size_type count_range(const Key &low, const Key &high) const;
 
   iterator begin();
   iterator end();
@@ -45,29 +128,81 @@ public:
   iterator end() const;
 
 public:
+  // узел красно-чёрного дерева; пустые поддеревья (nullptr) считаются чёрными.
+  // size — число узлов в поддереве, на нём держатся select и rank; цвет
+  // делит с ним одно слово, чтобы узел не вырос
   struct Node {
     value_type data;
     Node *left;
     Node *right;
     Node *parent;
+    size_type size : std::numeric_limits<size_type>::digits - 1;
+    size_type red : 1;
+
+    template <typename... Args> explicit Node(Args &&...args);
+  };
 
-    Node(const value_type &data);
+  // место для нового ключа: found — узел с равным ключом, если он уже есть
+  struct Position {
+    Node *parent;
+    Node *found;
+    bool to_left;
   };
 
+  // emplace(key, value) с готовым ключом ищет место до создания узла
+  template <typename... Args> struct leads_with_key : std::false_type {};
+  template <typename K, typename V>
+  struct leads_with_key<K, V>
+      : std::is_same<std::remove_cv_t<std::remove_reference_t<K>>, Key> {};
+
   Node *root_;
   size_type size_;
+  Compare comp_;
 
-  void clear(Node *node);
+  static void clear(Node *node);
+  static Node *clone(const Node *node, Node *parent);
+  template <typename InputIt> void build_sorted(InputIt first, InputIt last);
+  static Node *build_balanced(Node *&chain, size_type count, int depth,
+                              int black_depth);
+
+  template <typename K> Position locate(const K &key) const;
+  iterator attach(Node *node, const Position &pos);
+  void detach(Node *node, bool deferred = false);
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(K &&key, Args &&...args);
 
   void transplant(Node *u, Node *v);
+  void rotate_left(Node *node);
+  void rotate_right(Node *node);
+  void insert_fixup(Node *node);
+  void erase_fixup(Node *node, Node *parent);
+  static bool is_red(const Node *node);
+  static size_type size_of(const Node *node);
+  static void update_size(Node *node);
   static Node *minimum(Node *node);
   static Node *maximum(Node *node);
 
+  // столько поисков find_batch ведёт одновременно; дерево меньше
+  // kBatchMinSize узлов лежит в кеше, и там обычные поиски быстрее
+  static constexpr size_type kBatchWidth = 8;
+  static constexpr size_type kBatchMinSize = 16384;
+
+  template <typename K> Node *find_node(const K &key) const;
+  template <typename KeyIt, typename Visit>
+  void find_each(KeyIt first, KeyIt last, Visit visit) const;
+  template <typename K> Node *lower_node(const K &key) const;
+  template <typename K> Node *upper_node(const K &key) const;
+  template <typename K> size_type count_less(const K &key) const;
+
 public:
   Node *find(const Key &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Node *find(const K &key) const;
 };
 
-template <typename Key, typename T> class Map<Key, T>::iterator {
+template <typename Key, typename T, typename Compare>
+class Map<Key, T, Compare>::iterator {
 public:
   iterator(Node *node = nullptr);
 
@@ -89,6 +224,35 @@ private:
   Node *node_;
 };
 
+// владеющий дескриптор узла, извлечённого из Map; пустой после перемещения
+template <typename Key, typename T, typename Compare>
+class Map<Key, T, Compare>::node_type {
+public:
+  node_type() noexcept;
+  node_type(node_type &&other) noexcept;
+  node_type &operator=(node_type &&other) noexcept;
+  ~node_type();
+
+  bool empty() const noexcept;
+  explicit operator bool() const noexcept;
+  const Key &key() const;
+  T &mapped() const;
+
+private:
+  friend class Map;
+  explicit node_type(Node *node) noexcept;
+
+  Node *node_;
+};
+
+// если ключ уже был, node возвращает узел вызывающему
+template <typename Key, typename T, typename Compare>
+struct Map<Key, T, Compare>::insert_return_type {
+  iterator position;
+  bool inserted;
+  node_type node;
+};
+
 } // namespace s21
 #include "s21_map.cpp"
 #endif
\ No newline at end of file
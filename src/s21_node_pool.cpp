@@ -0,0 +1,196 @@
+#include "s21_node_pool.h"
+
+namespace s21 {
+
+template <typename T>
+NodePool<T>::NodePool()
+    : first_(nullptr), last_(nullptr), current_(nullptr), cursor_(nullptr),
+      cursor_end_(nullptr), free_(nullptr), free_tail_(nullptr),
+      capacity_(0), in_use_(0), slabs_(0) {}
+
+template <typename T> NodePool<T>::NodePool(size_type n) : NodePool() {
+  reserve(n);
+}
+
+template <typename T> NodePool<T>::~NodePool() {
+  while (first_) {
+    Slab *next = first_->next;
+    ::operator delete(first_, std::align_val_t(alignof(Slab)));
+    first_ = next;
+  }
+}
+
+template <typename T> T *NodePool<T>::allocate() {
+  Cell *cell = free_;
+  if (cell) {
+    Cell *rest = cell + 1;
+    if (rest != cell->link.end) {
+      rest->link.next = cell->link.next;
+      rest->link.end = cell->link.end;
+      if (free_tail_ == cell)
+        free_tail_ = rest;
+      free_ = rest;
+    } else {
+      free_ = cell->link.next;
+    }
+  } else {
+    if (cursor_ == cursor_end_ && !advance()) {
+      size_type count = capacity_ < kMinSlab ? kMinSlab : capacity_;
+      add_slab(count < kMaxSlab ? count : kMaxSlab);
+      advance();
+    }
+    cell = cursor_++;
+  }
+  ++in_use_;
+  return reinterpret_cast<T *>(cell);
+} // allocate(): сырая память под один узел, конструирует узел вызывающий
+
+template <typename T> void NodePool<T>::deallocate(T *node) noexcept {
+  push_free(reinterpret_cast<Cell *>(node));
+  --in_use_;
+} // deallocate(): узел уже должен быть разрушен
+
+template <typename T> void NodePool<T>::reserve(size_type n) {
+  size_type available = capacity_ - in_use_;
+  if (n > available) {
+    add_slab(n - available);
+  }
+} // reserve(n): следующие n вызовов allocate() не пойдут в operator new
+
+// prepare(n): как reserve(n), но недостающее добирается слабом обычного
+// для allocate() размера, чтобы частые мелкие пачки не плодили слабы
+template <typename T> void NodePool<T>::prepare(size_type n) {
+  size_type available = capacity_ - in_use_;
+  if (n > available) {
+    size_type count = capacity_ < kMinSlab ? kMinSlab : capacity_;
+    count = count < kMaxSlab ? count : kMaxSlab;
+    add_slab(count > n - available ? count : n - available);
+  }
+}
+
+/**
+ * release() возвращает пулу сразу все узлы за O(1): слабы остаются, выдача
+ * начинается с первого слаба заново. Вызывать только когда ни один узел
+ * больше не используется и все они уже разрушены.
+ */
+template <typename T> void NodePool<T>::release() noexcept {
+  free_ = nullptr;
+  current_ = nullptr;
+  cursor_ = cursor_end_ = nullptr;
+  in_use_ = 0;
+}
+
+/**
+ * merge() переносит все слабы from в into, чтобы узлы обоих пулов можно было
+ * перецеплять между списками. Занятые узлы from остаются на месте. Ячейки
+ * from не обходятся: остаток текущего слаба и каждый нетронутый слаб
+ * становятся одним отрезком в списке свободных into, а собственный список
+ * свободных from прицепляется целиком, поэтому слияние стоит O(число слабов).
+ * Сам from становится пустым и ссылается на into: списки, которые ещё держат
+ * from, находят актуальный пул через resolve().
+ */
+template <typename T>
+void NodePool<T>::merge(const std::shared_ptr<NodePool> &into,
+                        const std::shared_ptr<NodePool> &from) {
+  NodePool &dst = *into;
+  NodePool &src = *from;
+  if (&dst == &src || !src.first_)
+    return;
+
+  if (src.cursor_ != src.cursor_end_)
+    dst.push_run(src.cursor_, src.cursor_end_);
+  for (Slab *slab = src.current_ ? src.current_->next : src.first_; slab;
+       slab = slab->next)
+    dst.push_run(slab->cells(), slab->cells() + slab->count);
+  if (src.free_) {
+    src.free_tail_->link.next = dst.free_;
+    if (!dst.free_)
+      dst.free_tail_ = src.free_tail_;
+    dst.free_ = src.free_;
+  }
+
+  // слабы src ставятся в начало: последовательная выдача идёт только вперёд
+  // от current_ и до них не дойдёт
+  src.last_->next = dst.first_;
+  if (!dst.current_) {
+    dst.current_ = src.last_;
+    dst.cursor_ = dst.cursor_end_ = nullptr;
+  }
+  if (!dst.last_)
+    dst.last_ = src.last_;
+  dst.first_ = src.first_;
+  dst.capacity_ += src.capacity_;
+  dst.in_use_ += src.in_use_;
+  dst.slabs_ += src.slabs_;
+
+  src.first_ = src.last_ = src.current_ = nullptr;
+  src.cursor_ = src.cursor_end_ = nullptr;
+  src.free_ = src.free_tail_ = nullptr;
+  src.capacity_ = src.in_use_ = src.slabs_ = 0;
+  src.successor_ = into;
+}
+
+template <typename T>
+NodePool<T> &NodePool<T>::resolve(std::shared_ptr<NodePool> &pool) noexcept {
+  while (pool->successor_) {
+    std::shared_ptr<NodePool> next = pool->successor_;
+    pool = std::move(next);
+  }
+  return *pool;
+} // resolve(): переводит указатель на пул, в который были влиты узлы
+
+template <typename T>
+typename NodePool<T>::size_type NodePool<T>::capacity() const noexcept {
+  return capacity_;
+}
+
+template <typename T>
+typename NodePool<T>::size_type NodePool<T>::in_use() const noexcept {
+  return in_use_;
+}
+
+template <typename T>
+typename NodePool<T>::size_type NodePool<T>::slab_count() const noexcept {
+  return slabs_;
+}
+
+template <typename T> void NodePool<T>::push_free(Cell *cell) noexcept {
+  push_run(cell, cell + 1);
+}
+
+template <typename T>
+void NodePool<T>::push_run(Cell *first, Cell *end) noexcept {
+  first->link.next = free_;
+  first->link.end = end;
+  if (!free_)
+    free_tail_ = first;
+  free_ = first;
+}
+
+template <typename T> void NodePool<T>::add_slab(size_type count) {
+  void *raw = ::operator new(sizeof(Slab) + count * sizeof(Cell),
+                             std::align_val_t(alignof(Slab)));
+  Slab *slab = static_cast<Slab *>(raw);
+  slab->next = nullptr;
+  slab->count = count;
+  if (last_) {
+    last_->next = slab;
+  } else {
+    first_ = slab;
+  }
+  last_ = slab;
+  capacity_ += count;
+  ++slabs_;
+}
+
+template <typename T> bool NodePool<T>::advance() noexcept {
+  Slab *next = current_ ? current_->next : first_;
+  if (!next)
+    return false;
+  current_ = next;
+  cursor_ = next->cells();
+  cursor_end_ = cursor_ + next->count;
+  return true;
+} // advance(): переход к следующему ещё не начатому слабу
+
+} // namespace s21
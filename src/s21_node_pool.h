@@ -0,0 +1,76 @@
+#ifndef S21_NODE_POOL_H_
+#define S21_NODE_POOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace s21 {
+// Пул узлов фиксированного размера: память берётся слабами, освобождённые
+// узлы уходят в список свободных и переиспользуются без обращения к malloc.
+template <typename T> class NodePool {
+public:
+  using value_type = T;
+  using size_type = size_t;
+
+  NodePool();
+  explicit NodePool(size_type n);
+  NodePool(const NodePool &) = delete;
+  NodePool &operator=(const NodePool &) = delete;
+  ~NodePool();
+
+  T *allocate();
+  void deallocate(T *node) noexcept;
+  void reserve(size_type n);
+  void prepare(size_type n);
+  void release() noexcept;
+  static void merge(const std::shared_ptr<NodePool> &into,
+                    const std::shared_ptr<NodePool> &from);
+  static NodePool &resolve(std::shared_ptr<NodePool> &pool) noexcept;
+
+  size_type capacity() const noexcept;
+  size_type in_use() const noexcept;
+  size_type slab_count() const noexcept;
+
+private:
+  // свободная ячейка открывает отрезок [this, end) свободных ячеек подряд:
+  // так слаб целиком встаёт в список свободных одной записью
+  union Cell {
+    struct {
+      Cell *next;
+      Cell *end;
+    } link;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  struct alignas(Cell) Slab {
+    Slab *next;
+    size_type count;
+    Cell *cells() { return reinterpret_cast<Cell *>(this + 1); }
+  };
+
+  static constexpr size_type kMinSlab = 16;
+  static constexpr size_type kMaxSlab = 4096;
+
+  Slab *first_;
+  Slab *last_;
+  Slab *current_; // слаб, из которого узлы выдаются подряд
+  Cell *cursor_;
+  Cell *cursor_end_;
+  Cell *free_;
+  Cell *free_tail_; // последняя запись free_, пока он не пуст
+  size_type capacity_;
+  size_type in_use_;
+  size_type slabs_;
+  std::shared_ptr<NodePool> successor_; // пул, в который влит этот
+
+  void push_free(Cell *cell) noexcept;
+  void push_run(Cell *first, Cell *end) noexcept;
+  void add_slab(size_type count);
+  bool advance() noexcept;
+};
+
+} // namespace s21
+
+#include "s21_node_pool.cpp"
+#endif // S21_NODE_POOL_H_
@@ -0,0 +1,409 @@
+#include "s21_persistent_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::Node::Node(const value_type &value,
+                                             const Node *l, const Node *r)
+    : data(value), left(l), right(r), refs(1),
+      height(1 + (persistent_map::height(l) > persistent_map::height(r)
+                      ? persistent_map::height(l)
+                      : persistent_map::height(r))) {}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::persistent_map()
+    : root_(nullptr), size_(0), comp_() {}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::persistent_map(const Compare &comp)
+    : root_(nullptr), size_(0), comp_(comp) {}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::persistent_map(
+    std::initializer_list<value_type> init)
+    : persistent_map() {
+  for (const value_type &value : init)
+    *this = insert(value);
+}
+
+// снимок: общий корень и одно атомарное увеличение счётчика
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::persistent_map(
+    const persistent_map &other) noexcept
+    : root_(retain(other.root_)), size_(other.size_), comp_(other.comp_) {}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::persistent_map(
+    persistent_map &&other) noexcept
+    : root_(other.root_), size_(other.size_), comp_(other.comp_) {
+  other.root_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::~persistent_map() {
+  release(root_);
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare> &
+persistent_map<Key, T, Compare>::operator=(
+    const persistent_map &other) noexcept {
+  persistent_map copy(other);
+  swap(copy);
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare> &
+persistent_map<Key, T, Compare>::operator=(persistent_map &&other) noexcept {
+  persistent_map moved(std::move(other));
+  swap(moved);
+  return *this;
+}
+
+// если ключ уже есть, возвращается та же версия
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>
+persistent_map<Key, T, Compare>::insert(const value_type &value) const {
+  bool added = false;
+  const Node *root = insert_node(root_, value, false, added);
+  if (!root)
+    return *this;
+  return persistent_map(root, size_ + 1, comp_);
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>
+persistent_map<Key, T, Compare>::insert(const Key &key, const T &value) const {
+  return insert(value_type(key, value));
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>
+persistent_map<Key, T, Compare>::insert_or_assign(const Key &key,
+                                                  const T &value) const {
+  bool added = false;
+  const Node *root = insert_node(root_, value_type(key, value), true, added);
+  return persistent_map(root, size_ + (added ? 1 : 0), comp_);
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>
+persistent_map<Key, T, Compare>::erase(const Key &key) const {
+  if (!find_node(key))
+    return *this;
+  return persistent_map(erase_node(root_, key), size_ - 1, comp_);
+}
+
+template <typename Key, typename T, typename Compare>
+const T &persistent_map<Key, T, Compare>::at(const Key &key) const {
+  const Node *node = find_node(key);
+  if (!node)
+    throw std::out_of_range("Key not found");
+  return node->data.second;
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::iterator
+persistent_map<Key, T, Compare>::find(const Key &key) const {
+  iterator it;
+  const Node *node = root_;
+  while (node) {
+    if (comp_(key, node->data.first)) {
+      it.path_[it.depth_++] = node;
+      node = node->left;
+    } else if (comp_(node->data.first, key)) {
+      node = node->right;
+    } else {
+      it.path_[it.depth_++] = node;
+      return it;
+    }
+  }
+  return end();
+}
+
+template <typename Key, typename T, typename Compare>
+bool persistent_map<Key, T, Compare>::contains(const Key &key) const {
+  return find_node(key) != nullptr;
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::size_type
+persistent_map<Key, T, Compare>::count(const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+bool persistent_map<Key, T, Compare>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::size_type
+persistent_map<Key, T, Compare>::size() const noexcept {
+  return size_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::size_type
+persistent_map<Key, T, Compare>::max_size() const noexcept {
+  return size_type(-1) / sizeof(Node);
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::key_compare
+persistent_map<Key, T, Compare>::key_comp() const {
+  return comp_;
+}
+
+template <typename Key, typename T, typename Compare>
+void persistent_map<Key, T, Compare>::swap(persistent_map &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::iterator
+persistent_map<Key, T, Compare>::begin() const {
+  iterator it;
+  it.descend_left(root_);
+  return it;
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::iterator
+persistent_map<Key, T, Compare>::end() const {
+  return iterator();
+}
+
+// забирает ссылку на root
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::persistent_map(const Node *root,
+                                                size_type size,
+                                                const Compare &comp)
+    : root_(root), size_(size), comp_(comp) {}
+
+template <typename Key, typename T, typename Compare>
+const typename persistent_map<Key, T, Compare>::Node *
+persistent_map<Key, T, Compare>::find_node(const Key &key) const {
+  const Node *node = root_;
+  while (node) {
+    if (comp_(key, node->data.first))
+      node = node->left;
+    else if (comp_(node->data.first, key))
+      node = node->right;
+    else
+      return node;
+  }
+  return nullptr;
+}
+
+/**
+ * Возвращает новую ссылку на копию пути или nullptr, если дерево не
+ * изменилось (ключ есть, а assign == false) — тогда ничего не копируется.
+ * Копии узлов на пути собирает balance, он же восстанавливает баланс.
+ * Если копия значения или выделение бросит, уже собранная часть пути
+ * отпускается там же, где её приняли (make_node и balance), и исходная
+ * версия остаётся как была.
+ */
+template <typename Key, typename T, typename Compare>
+const typename persistent_map<Key, T, Compare>::Node *
+persistent_map<Key, T, Compare>::insert_node(const Node *node,
+                                             const value_type &value,
+                                             bool assign, bool &added) const {
+  if (!node) {
+    added = true;
+    return new Node(value, nullptr, nullptr);
+  }
+  if (comp_(value.first, node->data.first)) {
+    const Node *left = insert_node(node->left, value, assign, added);
+    return left ? balance(node->data, left, retain(node->right)) : nullptr;
+  }
+  if (comp_(node->data.first, value.first)) {
+    const Node *right = insert_node(node->right, value, assign, added);
+    return right ? balance(node->data, retain(node->left), right) : nullptr;
+  }
+  if (!assign)
+    return nullptr;
+  return make_node(value, retain(node->left), retain(node->right));
+}
+
+// ключ точно есть в поддереве: erase проверяет это заранее
+template <typename Key, typename T, typename Compare>
+const typename persistent_map<Key, T, Compare>::Node *
+persistent_map<Key, T, Compare>::erase_node(const Node *node,
+                                            const Key &key) const {
+  // новая ветвь строится до retain соседней: если erase_node бросит,
+  // лишней ссылки ещё нет
+  if (comp_(key, node->data.first)) {
+    const Node *left = erase_node(node->left, key);
+    return balance(node->data, left, retain(node->right));
+  }
+  if (comp_(node->data.first, key)) {
+    const Node *right = erase_node(node->right, key);
+    return balance(node->data, retain(node->left), right);
+  }
+  if (!node->left)
+    return retain(node->right);
+  if (!node->right)
+    return retain(node->left);
+  const Node *min = nullptr;
+  const Node *right = erase_min(node->right, min);
+  return balance(min->data, retain(node->left), right);
+}
+
+// копия поддерева без минимального узла; min остаётся жив в старой версии
+template <typename Key, typename T, typename Compare>
+const typename persistent_map<Key, T, Compare>::Node *
+persistent_map<Key, T, Compare>::erase_min(const Node *node,
+                                           const Node *&min) {
+  if (!node->left) {
+    min = node;
+    return retain(node->right);
+  }
+  const Node *left = erase_min(node->left, min);
+  return balance(node->data, left, retain(node->right));
+}
+
+// ссылки left и right переходят к новому узлу, а если копия data или
+// выделение бросит, отпускаются — как Map::clone разбирает недостроенное
+template <typename Key, typename T, typename Compare>
+const typename persistent_map<Key, T, Compare>::Node *
+persistent_map<Key, T, Compare>::make_node(const value_type &data,
+                                           const Node *left,
+                                           const Node *right) {
+  try {
+    return new Node(data, left, right);
+  } catch (...) {
+    release(left);
+    release(right);
+    throw;
+  }
+}
+
+/**
+ * Новый узел с data над поддеревьями left и right, ссылки на которые
+ * переходят к нему. Если высоты расходятся на 2, выполняется один или два
+ * поворота; повёрнутые узлы тоже копируются, ведь исходные могут входить
+ * в другие версии. Ссылки держат Hold, поэтому при исключении всё, что
+ * balance принял или успел построить, отпускается.
+ */
+template <typename Key, typename T, typename Compare>
+const typename persistent_map<Key, T, Compare>::Node *
+persistent_map<Key, T, Compare>::balance(const value_type &data,
+                                         const Node *left, const Node *right) {
+  Hold hold_left(left);
+  Hold hold_right(right);
+  int diff = height(left) - height(right);
+  if (diff > 1) {
+    if (height(left->left) >= height(left->right)) {
+      Hold lower(make_node(data, retain(left->right), hold_right.take()));
+      return make_node(left->data, retain(left->left), lower.take());
+    }
+    const Node *pivot = left->right;
+    Hold lower(make_node(left->data, retain(left->left), retain(pivot->left)));
+    Hold upper(make_node(data, retain(pivot->right), hold_right.take()));
+    return make_node(pivot->data, lower.take(), upper.take());
+  }
+  if (diff < -1) {
+    if (height(right->right) >= height(right->left)) {
+      Hold lower(make_node(data, hold_left.take(), retain(right->left)));
+      return make_node(right->data, lower.take(), retain(right->right));
+    }
+    const Node *pivot = right->left;
+    Hold lower(make_node(data, hold_left.take(), retain(pivot->left)));
+    Hold upper(
+        make_node(right->data, retain(pivot->right), retain(right->right)));
+    return make_node(pivot->data, lower.take(), upper.take());
+  }
+  return make_node(data, hold_left.take(), hold_right.take());
+}
+
+template <typename Key, typename T, typename Compare>
+const typename persistent_map<Key, T, Compare>::Node *
+persistent_map<Key, T, Compare>::Hold::take() noexcept {
+  const Node *node = node_;
+  node_ = nullptr;
+  return node;
+}
+
+template <typename Key, typename T, typename Compare>
+int persistent_map<Key, T, Compare>::height(const Node *node) noexcept {
+  return node ? node->height : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+const typename persistent_map<Key, T, Compare>::Node *
+persistent_map<Key, T, Compare>::retain(const Node *node) noexcept {
+  if (node)
+    node->refs.fetch_add(1, std::memory_order_relaxed);
+  return node;
+}
+
+// последняя ссылка удаляет узел и отпускает детей; acq_rel упорядочивает
+// удаление после всех чтений узла в других потоках
+template <typename Key, typename T, typename Compare>
+void persistent_map<Key, T, Compare>::release(const Node *node) noexcept {
+  while (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    const Node *right = node->right;
+    release(node->left);
+    delete node;
+    node = right;
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+persistent_map<Key, T, Compare>::iterator::iterator() : depth_(0) {}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::iterator::reference
+persistent_map<Key, T, Compare>::iterator::operator*() const {
+  return path_[depth_ - 1]->data;
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::iterator::pointer
+persistent_map<Key, T, Compare>::iterator::operator->() const {
+  return &path_[depth_ - 1]->data;
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::iterator &
+persistent_map<Key, T, Compare>::iterator::operator++() {
+  const Node *node = path_[--depth_];
+  descend_left(node->right);
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+typename persistent_map<Key, T, Compare>::iterator
+persistent_map<Key, T, Compare>::iterator::operator++(int) {
+  iterator old = *this;
+  ++*this;
+  return old;
+}
+
+template <typename Key, typename T, typename Compare>
+bool persistent_map<Key, T, Compare>::iterator::operator==(
+    const iterator &other) const {
+  if (depth_ != other.depth_)
+    return false;
+  return depth_ == 0 || path_[depth_ - 1] == other.path_[depth_ - 1];
+}
+
+template <typename Key, typename T, typename Compare>
+bool persistent_map<Key, T, Compare>::iterator::operator!=(
+    const iterator &other) const {
+  return !(*this == other);
+}
+
+template <typename Key, typename T, typename Compare>
+void persistent_map<Key, T, Compare>::iterator::descend_left(
+    const Node *node) {
+  for (; node; node = node->left)
+    path_[depth_++] = node;
+}
+
+} // namespace s21
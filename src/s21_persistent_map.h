@@ -0,0 +1,142 @@
+#ifndef S21_PERSISTENT_MAP_H_
+#define S21_PERSISTENT_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Неизменяемый упорядоченный массив на AVL-дереве с разделяемыми узлами.
+// insert, insert_or_assign и erase не трогают текущую версию, а возвращают
+// новую: копируется только путь от корня до изменённого места (O(log n)
+// узлов), остальные поддеревья общие. Копия версии — снимок за O(1).
+// Узлы считают ссылки атомарно, поэтому разные версии можно читать и
+// изменять из разных потоков; один объект persistent_map при этом не
+// защищён, как и любой другой контейнер.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class persistent_map {
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  class iterator;
+  using const_iterator = iterator;
+
+  persistent_map();
+  explicit persistent_map(const Compare &comp);
+  persistent_map(std::initializer_list<value_type> init);
+  persistent_map(const persistent_map &other) noexcept;
+  persistent_map(persistent_map &&other) noexcept;
+  ~persistent_map();
+
+  persistent_map &operator=(const persistent_map &other) noexcept;
+  persistent_map &operator=(persistent_map &&other) noexcept;
+
+  // изменения возвращают новую версию; результат нельзя терять
+  [[nodiscard]] persistent_map insert(const value_type &value) const;
+  [[nodiscard]] persistent_map insert(const Key &key, const T &value) const;
+  [[nodiscard]] persistent_map insert_or_assign(const Key &key,
+                                                const T &value) const;
+  [[nodiscard]] persistent_map erase(const Key &key) const;
+
+  const T &at(const Key &key) const;
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  size_type count(const Key &key) const;
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  key_compare key_comp() const;
+  void swap(persistent_map &other) noexcept;
+
+  iterator begin() const;
+  iterator end() const;
+
+private:
+  struct Node {
+    value_type data;
+    const Node *left;
+    const Node *right;
+    mutable std::atomic<size_type> refs;
+    int height;
+
+    Node(const value_type &value, const Node *l, const Node *r);
+  };
+
+  // владеющая ссылка на узел: отпускает его, если ссылку не забрали take()
+  class Hold {
+  public:
+    explicit Hold(const Node *node) noexcept : node_(node) {}
+    Hold(const Hold &) = delete;
+    Hold &operator=(const Hold &) = delete;
+    ~Hold() { release(node_); }
+    const Node *take() noexcept;
+
+  private:
+    const Node *node_;
+  };
+
+  const Node *root_;
+  size_type size_;
+  Compare comp_;
+
+  persistent_map(const Node *root, size_type size, const Compare &comp);
+
+  const Node *find_node(const Key &key) const;
+  const Node *insert_node(const Node *node, const value_type &value,
+                          bool assign, bool &added) const;
+  const Node *erase_node(const Node *node, const Key &key) const;
+  static const Node *erase_min(const Node *node, const Node *&min);
+  static const Node *make_node(const value_type &data, const Node *left,
+                               const Node *right);
+  static const Node *balance(const value_type &data, const Node *left,
+                             const Node *right);
+  static int height(const Node *node) noexcept;
+  static const Node *retain(const Node *node) noexcept;
+  static void release(const Node *node) noexcept;
+};
+
+// обход по возрастанию ключей; путь от корня хранится в самом итераторе,
+// так как у узлов нет ссылок на родителя — один узел входит в много версий
+template <typename Key, typename T, typename Compare>
+class persistent_map<Key, T, Compare>::iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = persistent_map::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+
+  iterator();
+
+  reference operator*() const;
+  pointer operator->() const;
+
+  iterator &operator++();
+  iterator operator++(int);
+
+  bool operator==(const iterator &other) const;
+  bool operator!=(const iterator &other) const;
+
+private:
+  friend class persistent_map;
+  // высота AVL-дерева меньше 1.45 * log2(n + 2)
+  static constexpr int kMaxDepth = 96;
+
+  const Node *path_[kMaxDepth];
+  int depth_;
+
+  void descend_left(const Node *node);
+};
+
+} // namespace s21
+
+#include "s21_persistent_map.cpp"
+#endif // S21_PERSISTENT_MAP_H_
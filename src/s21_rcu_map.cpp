@@ -0,0 +1,182 @@
+#include "s21_rcu_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare>
+rcu_map<Key, T, Compare>::rcu_map(size_type max_readers)
+    : current_(new version_type()), epoch_(1),
+      slots_(new Slot[max_readers ? max_readers : 1]),
+      slot_count_(max_readers ? max_readers : 1), writer_(), retired_() {}
+
+template <typename Key, typename T, typename Compare>
+rcu_map<Key, T, Compare>::~rcu_map() {
+  delete current_.load(std::memory_order_relaxed);
+  for (Retired *it = retired_.begin(); it != retired_.end(); ++it)
+    delete it->version;
+}
+
+template <typename Key, typename T, typename Compare>
+typename rcu_map<Key, T, Compare>::reader
+rcu_map<Key, T, Compare>::register_reader() {
+  for (size_type i = 0; i < slot_count_; ++i) {
+    bool expected = false;
+    if (slots_[i].used.compare_exchange_strong(expected, true,
+                                               std::memory_order_acquire))
+      return reader(this, &slots_[i]);
+  }
+  throw std::length_error("rcu_map: too many readers");
+}
+
+template <typename Key, typename T, typename Compare>
+void rcu_map<Key, T, Compare>::insert_or_assign(const Key &key,
+                                                const T &value) {
+  update([&](version_type &version) {
+    version = version.insert_or_assign(key, value);
+  });
+}
+
+template <typename Key, typename T, typename Compare>
+bool rcu_map<Key, T, Compare>::erase(const Key &key) {
+  std::lock_guard<std::mutex> lock(writer_);
+  const version_type *version = current_.load(std::memory_order_relaxed);
+  if (!version->contains(key))
+    return false;
+  publish(version->erase(key));
+  return true;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename F>
+void rcu_map<Key, T, Compare>::update(F &&f) {
+  std::lock_guard<std::mutex> lock(writer_);
+  version_type next = *current_.load(std::memory_order_relaxed);
+  f(next);
+  publish(std::move(next));
+}
+
+template <typename Key, typename T, typename Compare>
+typename rcu_map<Key, T, Compare>::version_type
+rcu_map<Key, T, Compare>::snapshot() const {
+  std::lock_guard<std::mutex> lock(writer_);
+  return *current_.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename T, typename Compare>
+typename rcu_map<Key, T, Compare>::size_type
+rcu_map<Key, T, Compare>::size() const {
+  std::lock_guard<std::mutex> lock(writer_);
+  return current_.load(std::memory_order_relaxed)->size();
+}
+
+template <typename Key, typename T, typename Compare>
+typename rcu_map<Key, T, Compare>::size_type
+rcu_map<Key, T, Compare>::retired() const {
+  std::lock_guard<std::mutex> lock(writer_);
+  return static_cast<size_type>(retired_.end() - retired_.begin());
+}
+
+template <typename Key, typename T, typename Compare>
+void rcu_map<Key, T, Compare>::reclaim() {
+  std::lock_guard<std::mutex> lock(writer_);
+  reclaim_locked();
+}
+
+/**
+ * Замена указателя и увеличение эпохи идут в этом порядке: читатель,
+ * увидевший новую эпоху (acquire), увидит и новую версию. Значит, старую
+ * версию может держать только читатель с эпохой меньше новой, и её можно
+ * освободить, когда таких читателей не останется.
+ */
+template <typename Key, typename T, typename Compare>
+void rcu_map<Key, T, Compare>::publish(version_type &&next) {
+  size_type count = static_cast<size_type>(retired_.end() - retired_.begin());
+  if (count == retired_.capacity())
+    retired_.reserve(count * 2 + 8); // после публикации push_back не бросает
+  const version_type *fresh = new version_type(std::move(next));
+  const version_type *old = current_.exchange(fresh);
+  std::uint64_t epoch = epoch_.fetch_add(1) + 1;
+  retired_.push_back(Retired{old, epoch});
+  reclaim_locked();
+}
+
+// забор в паре с забором читателя: если читатель загрузил старую версию,
+// его эпоха здесь уже видна
+template <typename Key, typename T, typename Compare>
+void rcu_map<Key, T, Compare>::reclaim_locked() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::uint64_t oldest = static_cast<std::uint64_t>(-1);
+  for (size_type i = 0; i < slot_count_; ++i) {
+    std::uint64_t epoch = slots_[i].epoch.load(std::memory_order_acquire);
+    if (epoch && epoch < oldest)
+      oldest = epoch;
+  }
+  Retired *out = retired_.begin();
+  for (Retired *it = retired_.begin(); it != retired_.end(); ++it) {
+    if (it->epoch <= oldest)
+      delete it->version;
+    else
+      *out++ = *it;
+  }
+  retired_.resize(static_cast<size_type>(out - retired_.begin()));
+}
+
+template <typename Key, typename T, typename Compare>
+rcu_map<Key, T, Compare>::reader::reader(rcu_map *map, Slot *slot) noexcept
+    : map_(map), slot_(slot) {}
+
+template <typename Key, typename T, typename Compare>
+rcu_map<Key, T, Compare>::reader::reader(reader &&other) noexcept
+    : map_(other.map_), slot_(other.slot_) {
+  other.slot_ = nullptr;
+}
+
+template <typename Key, typename T, typename Compare>
+rcu_map<Key, T, Compare>::reader::~reader() {
+  if (slot_)
+    slot_->used.store(false, std::memory_order_release);
+}
+
+/**
+ * Вход в чтение — две обычные записи и забор: эпоха в свою ячейку, затем
+ * загрузка указателя на версию. Забор не даёт загрузке обогнать запись,
+ * иначе писатель мог бы не заметить читателя и освободить версию у него
+ * из-под рук. Выход — запись нуля.
+ */
+template <typename Key, typename T, typename Compare>
+template <typename F>
+decltype(auto) rcu_map<Key, T, Compare>::reader::read(F &&f) {
+  struct exit_guard {
+    Slot *slot;
+    ~exit_guard() { slot->epoch.store(0, std::memory_order_release); }
+  };
+  slot_->epoch.store(map_->epoch_.load(std::memory_order_acquire),
+                     std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  exit_guard guard{slot_};
+  return f(*map_->current_.load(std::memory_order_acquire));
+}
+
+template <typename Key, typename T, typename Compare>
+std::optional<T> rcu_map<Key, T, Compare>::reader::find(const Key &key) {
+  return read([&key](const version_type &version) -> std::optional<T> {
+    auto it = version.find(key);
+    if (it == version.end())
+      return std::nullopt;
+    return it->second;
+  });
+}
+
+template <typename Key, typename T, typename Compare>
+bool rcu_map<Key, T, Compare>::reader::contains(const Key &key) {
+  return read([&key](const version_type &version) {
+    return version.contains(key);
+  });
+}
+
+template <typename Key, typename T, typename Compare>
+typename rcu_map<Key, T, Compare>::version_type
+rcu_map<Key, T, Compare>::reader::snapshot() {
+  return read([](const version_type &version) { return version; });
+}
+
+} // namespace s21
@@ -0,0 +1,113 @@
+#ifndef S21_RCU_MAP_H_
+#define S21_RCU_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_persistent_map.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Ассоциативный массив для таблиц, которые читают постоянно, а меняют
+// редко. Текущая версия — persistent_map за атомарным указателем. Читатель
+// отмечает в своей ячейке эпоху, читает указатель и дальше обходит
+// неизменяемое дерево без блокировок и атомарных read-modify-write.
+// Писатели сериализуются мьютексом: строят новую версию копированием пути,
+// публикуют её одной атомарной заменой указателя и откладывают старую до
+// тех пор, пока ни один читатель не может её видеть (эпохи).
+// Читать можно только через reader, полученный от register_reader(); все
+// читатели должны быть уничтожены раньше карты.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class rcu_map {
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using version_type = persistent_map<Key, T, Compare>;
+
+  class reader;
+
+  // max_readers — сколько читателей может быть зарегистрировано сразу
+  explicit rcu_map(size_type max_readers = 64);
+  rcu_map(const rcu_map &) = delete;
+  rcu_map &operator=(const rcu_map &) = delete;
+  ~rcu_map();
+
+  reader register_reader();
+
+  void insert_or_assign(const Key &key, const T &value);
+  bool erase(const Key &key);
+  // f получает копию текущей версии и меняет её; все изменения становятся
+  // видны читателям разом
+  template <typename F> void update(F &&f);
+
+  // снимок и размер с точки зрения писателя
+  version_type snapshot() const;
+  size_type size() const;
+  // число заменённых версий, которые ещё ждут освобождения
+  size_type retired() const;
+  // освобождает версии, которые уже не видит ни один читатель
+  void reclaim();
+
+private:
+  // 0 — читатель вне чтения; иначе эпоха, в которую он начал читать
+  struct alignas(64) Slot {
+    std::atomic<std::uint64_t> epoch{0};
+    std::atomic<bool> used{false};
+  };
+
+  struct Retired {
+    const version_type *version;
+    std::uint64_t epoch;
+  };
+
+  std::atomic<const version_type *> current_;
+  alignas(64) std::atomic<std::uint64_t> epoch_;
+  std::unique_ptr<Slot[]> slots_;
+  size_type slot_count_;
+  mutable std::mutex writer_;
+  vector<Retired> retired_;
+
+  void publish(version_type &&next);
+  void reclaim_locked();
+};
+
+// ячейка читателя в rcu_map; принадлежит одному потоку, чтения через один
+// reader не вкладываются друг в друга
+template <typename Key, typename T, typename Compare>
+class rcu_map<Key, T, Compare>::reader {
+public:
+  reader(reader &&other) noexcept;
+  reader(const reader &) = delete;
+  reader &operator=(const reader &) = delete;
+  reader &operator=(reader &&) = delete;
+  ~reader();
+
+  // f(const version_type &) выполняется внутри чтения; ссылки на элементы
+  // нельзя выносить за пределы f
+  template <typename F> decltype(auto) read(F &&f);
+  std::optional<T> find(const Key &key);
+  bool contains(const Key &key);
+  // собственная ссылка на текущую версию, живущая без чтения
+  version_type snapshot();
+
+private:
+  friend class rcu_map;
+  reader(rcu_map *map, Slot *slot) noexcept;
+
+  rcu_map *map_;
+  Slot *slot_;
+};
+
+} // namespace s21
+
+#include "s21_rcu_map.cpp"
+#endif // S21_RCU_MAP_H_
@@ -0,0 +1,304 @@
+#include "s21_unordered_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual>::unordered_map() : table_() {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual>::unordered_map(size_type count,
+                                                     const Hash &hash,
+                                                     const KeyEqual &equal)
+    : table_(hash, equal) {
+  table_.reserve(count);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual>::unordered_map(
+    std::initializer_list<value_type> init)
+    : unordered_map() {
+  insert(init.begin(), init.end());
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename InputIt>
+unordered_map<Key, T, Hash, KeyEqual>::unordered_map(InputIt first,
+                                                     InputIt last)
+    : unordered_map() {
+  insert(first, last);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T &unordered_map<Key, T, Hash, KeyEqual>::at(const Key &key) {
+  size_type index = table_.find(key);
+  if (index == table_type::npos)
+    throw std::out_of_range("Key not found");
+  return table_.slot(index).second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K, typename H, typename E, typename, typename>
+T &unordered_map<Key, T, Hash, KeyEqual>::at(const K &key) {
+  size_type index = table_.find(key);
+  if (index == table_type::npos)
+    throw std::out_of_range("Key not found");
+  return table_.slot(index).second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T &unordered_map<Key, T, Hash, KeyEqual>::operator[](const Key &key) {
+  return try_emplace(key).first->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T &unordered_map<Key, T, Hash, KeyEqual>::operator[](Key &&key) {
+  return try_emplace(std::move(key)).first->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool unordered_map<Key, T, Hash, KeyEqual>::empty() const noexcept {
+  return table_.size() == 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::size_type
+unordered_map<Key, T, Hash, KeyEqual>::size() const noexcept {
+  return table_.size();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::size_type
+unordered_map<Key, T, Hash, KeyEqual>::max_size() const noexcept {
+  return table_.max_size();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::size_type
+unordered_map<Key, T, Hash, KeyEqual>::bucket_count() const noexcept {
+  return table_.capacity();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+float unordered_map<Key, T, Hash, KeyEqual>::load_factor() const noexcept {
+  return table_.capacity() ? static_cast<float>(table_.size()) /
+                                 static_cast<float>(table_.capacity())
+                           : 0.0f;
+}
+
+// после reserve(count) вставка count ключей не перестраивает таблицу
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void unordered_map<Key, T, Hash, KeyEqual>::reserve(size_type count) {
+  table_.reserve(count);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void unordered_map<Key, T, Hash, KeyEqual>::clear() {
+  table_.clear();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::insert(const value_type &value) {
+  return emplace_key(value.first, value);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::insert(value_type &&value) {
+  return emplace_key(value.first, std::move(value));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename InputIt>
+void unordered_map<Key, T, Hash, KeyEqual>::insert(InputIt first,
+                                                   InputIt last) {
+  for (; first != last; ++first)
+    insert(*first);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename M>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::insert_or_assign(const Key &key,
+                                                        M &&value) {
+  auto result = try_emplace(key, std::forward<M>(value));
+  if (!result.second)
+    result.first->second = std::forward<M>(value);
+  return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename M>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::insert_or_assign(Key &&key,
+                                                        M &&value) {
+  auto result = try_emplace(std::move(key), std::forward<M>(value));
+  if (!result.second)
+    result.first->second = std::forward<M>(value);
+  return result;
+}
+
+// ключ в ячейке и так строится из готовой пары, поэтому пара собирается
+// заранее, а в таблицу переезжает только если ключа ещё нет
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::emplace(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return emplace_key(value.first, std::move(value));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::try_emplace(const Key &key,
+                                                   Args &&...args) {
+  return emplace_key(key, std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::try_emplace(Key &&key, Args &&...args) {
+  return emplace_key(key, std::piecewise_construct,
+                     std::forward_as_tuple(std::move(key)),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void unordered_map<Key, T, Hash, KeyEqual>::erase(iterator pos) {
+  table_.erase_at(pos.index());
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::size_type
+unordered_map<Key, T, Hash, KeyEqual>::erase(const Key &key) {
+  size_type index = table_.find(key);
+  if (index == table_type::npos)
+    return 0;
+  table_.erase_at(index);
+  return 1;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void unordered_map<Key, T, Hash, KeyEqual>::swap(
+    unordered_map &other) noexcept {
+  table_.swap(other.table_);
+}
+
+// ключи, которых здесь нет, переезжают, повторы остаются в other. После
+// удаления в ту же ячейку может сдвинуться следующий элемент, поэтому она
+// проверяется ещё раз
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void unordered_map<Key, T, Hash, KeyEqual>::merge(unordered_map &other) {
+  if (this == &other)
+    return;
+  size_type index = other.table_.first();
+  while (index != other.table_.capacity()) {
+    value_type &value = other.table_.slot(index);
+    if (table_.emplace_key(value.first, std::move(value)).second) {
+      other.table_.erase_at(index);
+      if (other.table_.occupied(index))
+        continue;
+    }
+    index = other.table_.next(index);
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::iterator
+unordered_map<Key, T, Hash, KeyEqual>::find(const Key &key) {
+  return at_index(table_.find(key));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::const_iterator
+unordered_map<Key, T, Hash, KeyEqual>::find(const Key &key) const {
+  size_type index = table_.find(key);
+  return index == table_type::npos ? end() : const_iterator(&table_, index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K, typename H, typename E, typename, typename>
+typename unordered_map<Key, T, Hash, KeyEqual>::iterator
+unordered_map<Key, T, Hash, KeyEqual>::find(const K &key) {
+  return at_index(table_.find(key));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool unordered_map<Key, T, Hash, KeyEqual>::contains(const Key &key) const {
+  return table_.find(key) != table_type::npos;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K, typename H, typename E, typename, typename>
+bool unordered_map<Key, T, Hash, KeyEqual>::contains(const K &key) const {
+  return table_.find(key) != table_type::npos;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::size_type
+unordered_map<Key, T, Hash, KeyEqual>::count(const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K, typename H, typename E, typename, typename>
+typename unordered_map<Key, T, Hash, KeyEqual>::size_type
+unordered_map<Key, T, Hash, KeyEqual>::count(const K &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::hasher
+unordered_map<Key, T, Hash, KeyEqual>::hash_function() const {
+  return table_.hash_function();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::key_equal
+unordered_map<Key, T, Hash, KeyEqual>::key_eq() const {
+  return table_.key_eq();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::iterator
+unordered_map<Key, T, Hash, KeyEqual>::begin() {
+  return iterator(&table_, table_.first());
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::iterator
+unordered_map<Key, T, Hash, KeyEqual>::end() {
+  return iterator(&table_, table_.capacity());
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::const_iterator
+unordered_map<Key, T, Hash, KeyEqual>::begin() const {
+  return const_iterator(&table_, table_.first());
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::const_iterator
+unordered_map<Key, T, Hash, KeyEqual>::end() const {
+  return const_iterator(&table_, table_.capacity());
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename unordered_map<Key, T, Hash, KeyEqual>::iterator
+unordered_map<Key, T, Hash, KeyEqual>::at_index(size_type index) {
+  return index == table_type::npos ? end() : iterator(&table_, index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K, typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::emplace_key(const K &key,
+                                                   Args &&...args) {
+  auto result = table_.emplace_key(key, std::forward<Args>(args)...);
+  return {iterator(&table_, result.first), result.second};
+}
+
+} // namespace s21
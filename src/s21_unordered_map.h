@@ -0,0 +1,121 @@
+#ifndef S21_UNORDERED_MAP_H_
+#define S21_UNORDERED_MAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+// Хеш-таблица в духе Swiss table поверх hash_table: пары лежат прямо в
+// массиве ячеек, поиск сравнивает 7-битные теги группами по 16. Интерфейс
+// повторяет Map, кроме упорядоченных запросов. Если у Hash и KeyEqual есть
+// is_transparent, find, contains, at и count принимают любой тип, который
+// оба умеют обработать, без построения Key.
+// Пары хранятся как std::pair<Key, T>, чтобы перестройка и удаление
+// перемещали ключи; менять ключ через итератор нельзя. Вставка может
+// перестроить таблицу, удаление сдвигает соседние элементы — и то и другое
+// делает итераторы недействительными.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map {
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+private:
+  struct key_of {
+    const Key &operator()(const value_type &value) const {
+      return value.first;
+    }
+  };
+  using table_type = hash_table<value_type, Key, key_of, Hash, KeyEqual>;
+
+public:
+  using iterator = hash_iterator<table_type, value_type &>;
+  using const_iterator = hash_iterator<const table_type, const value_type &>;
+
+  unordered_map();
+  explicit unordered_map(size_type count, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual());
+  unordered_map(std::initializer_list<value_type> init);
+  template <typename InputIt> unordered_map(InputIt first, InputIt last);
+
+  T &at(const Key &key);
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  T &at(const K &key);
+  T &operator[](const Key &key);
+  T &operator[](Key &&key);
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  size_type bucket_count() const noexcept;
+  float load_factor() const noexcept;
+  void reserve(size_type count);
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <typename InputIt> void insert(InputIt first, InputIt last);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key &key, M &&value);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(Key &&key, M &&value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+  void erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(unordered_map &other) noexcept;
+  void merge(unordered_map &other);
+
+  iterator find(const Key &key);
+  const_iterator find(const Key &key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  iterator find(const K &key);
+  bool contains(const Key &key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  bool contains(const K &key) const;
+  size_type count(const Key &key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  size_type count(const K &key) const;
+  hasher hash_function() const;
+  key_equal key_eq() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+private:
+  table_type table_;
+
+  iterator at_index(size_type index);
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(const K &key, Args &&...args);
+};
+
+} // namespace s21
+
+#include "s21_unordered_map.cpp"
+#endif // S21_UNORDERED_MAP_H_
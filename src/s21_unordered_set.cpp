@@ -0,0 +1,202 @@
+#include "s21_unordered_set.h"
+
+namespace s21 {
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>::unordered_set() : table_() {}
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(size_type count,
+                                                  const Hash &hash,
+                                                  const KeyEqual &equal)
+    : table_(hash, equal) {
+  table_.reserve(count);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(
+    std::initializer_list<value_type> init)
+    : unordered_set() {
+  insert(init.begin(), init.end());
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename InputIt>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(InputIt first, InputIt last)
+    : unordered_set() {
+  insert(first, last);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+bool unordered_set<Key, Hash, KeyEqual>::empty() const noexcept {
+  return table_.size() == 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::size_type
+unordered_set<Key, Hash, KeyEqual>::size() const noexcept {
+  return table_.size();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::size_type
+unordered_set<Key, Hash, KeyEqual>::max_size() const noexcept {
+  return table_.max_size();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::size_type
+unordered_set<Key, Hash, KeyEqual>::bucket_count() const noexcept {
+  return table_.capacity();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+float unordered_set<Key, Hash, KeyEqual>::load_factor() const noexcept {
+  return table_.capacity() ? static_cast<float>(table_.size()) /
+                                 static_cast<float>(table_.capacity())
+                           : 0.0f;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void unordered_set<Key, Hash, KeyEqual>::reserve(size_type count) {
+  table_.reserve(count);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void unordered_set<Key, Hash, KeyEqual>::clear() {
+  table_.clear();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>
+unordered_set<Key, Hash, KeyEqual>::insert(const value_type &value) {
+  auto result = table_.emplace_key(value, value);
+  return {iterator(&table_, result.first), result.second};
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>
+unordered_set<Key, Hash, KeyEqual>::insert(value_type &&value) {
+  auto result = table_.emplace_key(value, std::move(value));
+  return {iterator(&table_, result.first), result.second};
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename InputIt>
+void unordered_set<Key, Hash, KeyEqual>::insert(InputIt first, InputIt last) {
+  for (; first != last; ++first)
+    insert(*first);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>
+unordered_set<Key, Hash, KeyEqual>::emplace(Args &&...args) {
+  return insert(Key(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void unordered_set<Key, Hash, KeyEqual>::erase(iterator pos) {
+  table_.erase_at(pos.index());
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::size_type
+unordered_set<Key, Hash, KeyEqual>::erase(const Key &key) {
+  size_type index = table_.find(key);
+  if (index == table_type::npos)
+    return 0;
+  table_.erase_at(index);
+  return 1;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void unordered_set<Key, Hash, KeyEqual>::swap(unordered_set &other) noexcept {
+  table_.swap(other.table_);
+}
+
+// как unordered_map::merge: ячейка после удаления проверяется ещё раз
+template <typename Key, typename Hash, typename KeyEqual>
+void unordered_set<Key, Hash, KeyEqual>::merge(unordered_set &other) {
+  if (this == &other)
+    return;
+  size_type index = other.table_.first();
+  while (index != other.table_.capacity()) {
+    Key &key = other.table_.slot(index);
+    if (table_.emplace_key(key, std::move(key)).second) {
+      other.table_.erase_at(index);
+      if (other.table_.occupied(index))
+        continue;
+    }
+    index = other.table_.next(index);
+  }
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::iterator
+unordered_set<Key, Hash, KeyEqual>::find(const Key &key) const {
+  return at_index(table_.find(key));
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename K, typename H, typename E, typename, typename>
+typename unordered_set<Key, Hash, KeyEqual>::iterator
+unordered_set<Key, Hash, KeyEqual>::find(const K &key) const {
+  return at_index(table_.find(key));
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+bool unordered_set<Key, Hash, KeyEqual>::contains(const Key &key) const {
+  return table_.find(key) != table_type::npos;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename K, typename H, typename E, typename, typename>
+bool unordered_set<Key, Hash, KeyEqual>::contains(const K &key) const {
+  return table_.find(key) != table_type::npos;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::size_type
+unordered_set<Key, Hash, KeyEqual>::count(const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename K, typename H, typename E, typename, typename>
+typename unordered_set<Key, Hash, KeyEqual>::size_type
+unordered_set<Key, Hash, KeyEqual>::count(const K &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::hasher
+unordered_set<Key, Hash, KeyEqual>::hash_function() const {
+  return table_.hash_function();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::key_equal
+unordered_set<Key, Hash, KeyEqual>::key_eq() const {
+  return table_.key_eq();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::iterator
+unordered_set<Key, Hash, KeyEqual>::begin() const {
+  return iterator(&table_, table_.first());
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::iterator
+unordered_set<Key, Hash, KeyEqual>::end() const {
+  return iterator(&table_, table_.capacity());
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename unordered_set<Key, Hash, KeyEqual>::iterator
+unordered_set<Key, Hash, KeyEqual>::at_index(size_type index) const {
+  return index == table_type::npos ? end() : iterator(&table_, index);
+}
+
+} // namespace s21
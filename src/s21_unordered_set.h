@@ -0,0 +1,89 @@
+#ifndef S21_UNORDERED_SET_H_
+#define S21_UNORDERED_SET_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+// Множество на той же хеш-таблице, что и unordered_map, без отображаемых
+// значений. Итераторы константные и становятся недействительными после
+// любой вставки или удаления.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_set {
+public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+private:
+  struct key_of {
+    const Key &operator()(const Key &key) const { return key; }
+  };
+  using table_type = hash_table<Key, Key, key_of, Hash, KeyEqual>;
+
+public:
+  using iterator = hash_iterator<const table_type, const Key &>;
+  using const_iterator = iterator;
+
+  unordered_set();
+  explicit unordered_set(size_type count, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual());
+  unordered_set(std::initializer_list<value_type> init);
+  template <typename InputIt> unordered_set(InputIt first, InputIt last);
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  size_type bucket_count() const noexcept;
+  float load_factor() const noexcept;
+  void reserve(size_type count);
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <typename InputIt> void insert(InputIt first, InputIt last);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  void erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(unordered_set &other) noexcept;
+  void merge(unordered_set &other);
+
+  iterator find(const Key &key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  iterator find(const K &key) const;
+  bool contains(const Key &key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  bool contains(const K &key) const;
+  size_type count(const Key &key) const;
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = typename H::is_transparent,
+            typename = typename E::is_transparent>
+  size_type count(const K &key) const;
+  hasher hash_function() const;
+  key_equal key_eq() const;
+
+  iterator begin() const;
+  iterator end() const;
+
+private:
+  table_type table_;
+
+  iterator at_index(size_type index) const;
+};
+
+} // namespace s21
+
+#include "s21_unordered_set.cpp"
+#endif // S21_UNORDERED_SET_H_
@@ -0,0 +1,566 @@
+#include "s21_unrolled_list.h"
+
+namespace s21 {
+
+// Итераторы: (список, чанк, индекс внутри чанка), end() — (список, nullptr, 0)
+template <typename T, size_t B>
+T &unrolled_list<T, B>::Iterator::operator*() {
+  return chunk_->items()[index_];
+}
+
+template <typename T, size_t B>
+typename unrolled_list<T, B>::Iterator &
+unrolled_list<T, B>::Iterator::operator++() {
+  if (++index_ == chunk_->count) {
+    chunk_ = chunk_->next;
+    index_ = 0;
+  }
+  return *this;
+}
+
+template <typename T, size_t B>
+typename unrolled_list<T, B>::Iterator &
+unrolled_list<T, B>::Iterator::operator--() {
+  if (index_ > 0) {
+    --index_;
+  } else {
+    chunk_ = chunk_ ? chunk_->prev : list_->tail;
+    index_ = chunk_ ? chunk_->count - 1 : 0;
+  }
+  return *this;
+}
+
+template <typename T, size_t B>
+bool unrolled_list<T, B>::Iterator::operator==(const Iterator &other) const {
+  return chunk_ == other.chunk_ && index_ == other.index_;
+}
+
+template <typename T, size_t B>
+bool unrolled_list<T, B>::Iterator::operator!=(const Iterator &other) const {
+  return !(*this == other);
+}
+
+// методы unrolled_list
+
+template <typename T, size_t B>
+unrolled_list<T, B>::unrolled_list()
+    : head(nullptr), tail(nullptr), length(0), chunks(0) {}
+
+template <typename T, size_t B>
+unrolled_list<T, B>::unrolled_list(std::initializer_list<T> const &items)
+    : unrolled_list() {
+  for (const T &value : items)
+    push_back(value);
+}
+
+template <typename T, size_t B>
+unrolled_list<T, B>::unrolled_list(const unrolled_list &other)
+    : unrolled_list() {
+  for (Chunk *chunk = other.head; chunk; chunk = chunk->next) {
+    for (size_type i = 0; i < chunk->count; ++i)
+      push_back(chunk->items()[i]);
+  }
+}
+
+template <typename T, size_t B>
+unrolled_list<T, B>::unrolled_list(unrolled_list &&other) noexcept
+    : unrolled_list() {
+  swap(other);
+}
+
+template <typename T, size_t B> unrolled_list<T, B>::~unrolled_list() {
+  clear();
+}
+
+template <typename T, size_t B>
+unrolled_list<T, B> &
+unrolled_list<T, B>::operator=(unrolled_list &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T, size_t B> T &unrolled_list<T, B>::front() {
+  return head->items()[0];
+}
+
+template <typename T, size_t B> const T &unrolled_list<T, B>::front() const {
+  return head->items()[0];
+}
+
+template <typename T, size_t B> T &unrolled_list<T, B>::back() {
+  return tail->items()[tail->count - 1];
+}
+
+template <typename T, size_t B> const T &unrolled_list<T, B>::back() const {
+  return tail->items()[tail->count - 1];
+}
+
+template <typename T, size_t B>
+typename unrolled_list<T, B>::Iterator unrolled_list<T, B>::begin() {
+  return Iterator(this, head);
+}
+
+template <typename T, size_t B>
+typename unrolled_list<T, B>::Iterator unrolled_list<T, B>::end() {
+  return Iterator(this, nullptr);
+}
+
+template <typename T, size_t B> bool unrolled_list<T, B>::empty() const {
+  return length == 0;
+}
+
+template <typename T, size_t B> size_t unrolled_list<T, B>::size() const {
+  return length;
+}
+
+template <typename T, size_t B> size_t unrolled_list<T, B>::max_size() const {
+  return static_cast<size_t>(-1) / sizeof(Chunk) * chunk_capacity;
+}
+
+template <typename T, size_t B>
+size_t unrolled_list<T, B>::chunk_count() const {
+  return chunks;
+}
+
+template <typename T, size_t B> void unrolled_list<T, B>::clear() {
+  while (head) {
+    Chunk *next = head->next;
+    for (size_type i = 0; i < head->count; ++i)
+      head->items()[i].~T();
+    delete head;
+    head = next;
+  }
+  tail = nullptr;
+  length = 0;
+  chunks = 0;
+}
+
+template <typename T, size_t B>
+typename unrolled_list<T, B>::Iterator
+unrolled_list<T, B>::insert(Iterator pos, const T &value) {
+  return emplace(pos, value);
+}
+
+template <typename T, size_t B>
+typename unrolled_list<T, B>::Iterator
+unrolled_list<T, B>::insert(Iterator pos, T &&value) {
+  return emplace(pos, std::move(value));
+}
+
+/**
+ * emplace создаёт элемент перед pos. Если в чанке нет места, он делится
+ * пополам, поэтому вставка в середину сдвигает не больше chunk_capacity
+ * элементов. В конец элемент строится сразу на месте: там ничего не
+ * сдвигается. В середине значение сначала собирается во временный объект —
+ * аргументы могут ссылаться на элементы этого же списка, которые сдвиг или
+ * деление чанка переместят.
+ */
+template <typename T, size_t B>
+template <typename... Args>
+typename unrolled_list<T, B>::Iterator
+unrolled_list<T, B>::emplace(Iterator pos, Args &&...args) {
+  Chunk *chunk = pos.chunk_;
+  size_type at = pos.index_;
+  if (!chunk) {
+    chunk = tail;
+    if (!chunk || chunk->count == chunk_capacity)
+      chunk = new_chunk_after(tail);
+    at = chunk->count;
+    try {
+      new (chunk->items() + at) T(std::forward<Args>(args)...);
+    } catch (...) {
+      if (chunk->count == 0)
+        delete_chunk(chunk);
+      throw;
+    }
+  } else {
+    T value(std::forward<Args>(args)...);
+    if (chunk->count == chunk_capacity) {
+      size_type half = chunk_capacity / 2;
+      Chunk *upper = split(chunk, half);
+      if (at > half) {
+        chunk = upper;
+        at -= half;
+      }
+    }
+    open_gap(chunk, at);
+    try {
+      new (chunk->items() + at) T(std::move(value));
+    } catch (...) {
+      ++chunk->count; // щель at должна входить в сдвигаемый диапазон
+      close_gap(chunk, at);
+      --chunk->count;
+      throw;
+    }
+  }
+  ++chunk->count;
+  ++length;
+  return Iterator(this, chunk, at);
+}
+
+template <typename T, size_t B>
+void unrolled_list<T, B>::erase(Iterator pos) {
+  Chunk *chunk = pos.chunk_;
+  if (chunk) {
+    chunk->items()[pos.index_].~T();
+    close_gap(chunk, pos.index_);
+    --chunk->count;
+    --length;
+    rebalance(chunk);
+  }
+}
+
+template <typename T, size_t B>
+void unrolled_list<T, B>::push_back(const T &value) {
+  emplace(end(), value);
+}
+
+template <typename T, size_t B>
+void unrolled_list<T, B>::push_back(T &&value) {
+  emplace(end(), std::move(value));
+}
+
+template <typename T, size_t B> void unrolled_list<T, B>::pop_back() {
+  if (tail)
+    erase(Iterator(this, tail, tail->count - 1));
+}
+
+template <typename T, size_t B>
+void unrolled_list<T, B>::push_front(const T &value) {
+  emplace(begin(), value);
+}
+
+template <typename T, size_t B>
+void unrolled_list<T, B>::push_front(T &&value) {
+  emplace(begin(), std::move(value));
+}
+
+template <typename T, size_t B> void unrolled_list<T, B>::pop_front() {
+  if (!head)
+    throw std::out_of_range("pop_front() called on empty list");
+  erase(begin());
+}
+
+template <typename T, size_t B>
+void unrolled_list<T, B>::swap(unrolled_list &other) noexcept {
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(length, other.length);
+  std::swap(chunks, other.chunks);
+}
+
+// splice перецепляет чанки other целиком, копируется не больше одного чанка
+template <typename T, size_t B>
+void unrolled_list<T, B>::splice(Iterator pos, unrolled_list &other) {
+  if (this == &other || other.empty())
+    return;
+  Chunk *before = tail;
+  if (pos.chunk_) {
+    before = pos.chunk_->prev;
+    if (pos.index_ > 0) {
+      split(pos.chunk_, pos.index_);
+      before = pos.chunk_;
+    }
+  }
+  Chunk *after = before ? before->next : head;
+  other.head->prev = before;
+  other.tail->next = after;
+  if (before)
+    before->next = other.head;
+  else
+    head = other.head;
+  if (after)
+    after->prev = other.tail;
+  else
+    tail = other.tail;
+  length += other.length;
+  chunks += other.chunks;
+  other.head = other.tail = nullptr;
+  other.length = other.chunks = 0;
+}
+
+template <typename T, size_t B> void unrolled_list<T, B>::sort() {
+  sort(std::less<>());
+}
+
+/**
+ * Сортировка слиянием по цепочкам чанков: каждый чанк сортируется на месте,
+ * затем цепочки сливаются попарно. Слияние пишет в полные чанки и забирает
+ * под вывод те входные, что уже опустели, поэтому сверх самих чанков нужны
+ * лишь два запасных, а не буфер на весь список. Порядок равных сохраняется.
+ * Если бросит comp, каждый элемент остаётся в каком-то чанке: исходные
+ * чанки находятся по prev, которого сортировка не трогает, и вместе с
+ * запасными снова связываются в список, пустые удаляются. Порядок тогда не
+ * задан, но size() и сами элементы прежние.
+ */
+template <typename T, size_t B>
+template <typename Compare>
+void unrolled_list<T, B>::sort(Compare comp) {
+  if (length < 2)
+    return;
+  Chunk *spare = nullptr;
+  if (chunks > 1) {
+    spare = new Chunk;
+    spare->next = nullptr;
+    spare->count = 0;
+    try {
+      spare->next = new Chunk;
+      spare->next->next = nullptr;
+      spare->next->count = 0;
+    } catch (...) {
+      delete spare;
+      throw;
+    }
+  }
+  Chunk *extra[] = {spare, spare ? spare->next : nullptr};
+  Chunk *last = tail;
+  try {
+    head = sort_chunks(head, chunks, spare, comp);
+  } catch (...) {
+    head = tail = nullptr;
+    chunks = 0;
+    auto adopt = [this](Chunk *chunk) {
+      if (chunk->count == 0) {
+        delete chunk;
+        return;
+      }
+      chunk->prev = nullptr;
+      chunk->next = head;
+      (head ? head->prev : tail) = chunk;
+      head = chunk;
+      ++chunks;
+    };
+    for (Chunk *chunk = last; chunk;) {
+      Chunk *prev = chunk->prev;
+      adopt(chunk);
+      chunk = prev;
+    }
+    for (Chunk *chunk : extra) {
+      if (chunk)
+        adopt(chunk);
+    }
+    throw;
+  }
+  while (spare) {
+    Chunk *next = spare->next;
+    delete spare;
+    spare = next;
+  }
+  chunks = 0;
+  tail = nullptr;
+  for (Chunk *chunk = head; chunk; chunk = chunk->next) {
+    chunk->prev = tail;
+    tail = chunk;
+    ++chunks;
+  }
+}
+
+// sort_chunks сортирует цепочку из count чанков, связанных через next.
+// Внутри чанка — вставками: место ищется до перемещений, поэтому брошенное
+// сравнение не оставляет дыр
+template <typename T, size_t B>
+template <typename Compare>
+typename unrolled_list<T, B>::Chunk *
+unrolled_list<T, B>::sort_chunks(Chunk *first, size_type count, Chunk *&spare,
+                                 Compare &comp) {
+  if (count == 1) {
+    T *items = first->items();
+    for (size_type i = 1; i < first->count; ++i)
+      std::rotate(std::upper_bound(items, items + i, items[i], comp),
+                  items + i, items + i + 1);
+    first->next = nullptr;
+    return first;
+  }
+  Chunk *last = first;
+  for (size_type i = 1; i < count / 2; ++i)
+    last = last->next;
+  Chunk *second = last->next;
+  Chunk *a = sort_chunks(first, count / 2, spare, comp);
+  Chunk *b = sort_chunks(second, count - count / 2, spare, comp);
+  return merge_chunks(a, b, spare, comp);
+}
+
+/**
+ * merge_chunks сливает две упорядоченные цепочки в новую из полных чанков.
+ * Опустевший входной чанк уходит в spare и идёт под вывод. Недочитанными
+ * бывают только два головных чанка, поэтому опустевших входных не меньше,
+ * чем взято под вывод без одного, и двух запасных хватает всегда.
+ */
+template <typename T, size_t B>
+template <typename Compare>
+typename unrolled_list<T, B>::Chunk *
+unrolled_list<T, B>::merge_chunks(Chunk *a, Chunk *b, Chunk *&spare,
+                                  Compare &comp) {
+  Chunk *first = nullptr;
+  Chunk *out = nullptr;
+  size_type ia = 0;
+  size_type ib = 0;
+  while (a || b) {
+    bool from_a = !b;
+    try {
+      from_a = from_a || (a && !comp(b->items()[ib], a->items()[ia]));
+    } catch (...) {
+      // comp зовётся, только когда есть обе головы; забранные из них
+      // элементы уже разрушены
+      drop_front(a, ia);
+      drop_front(b, ib);
+      throw;
+    }
+    Chunk *&src = from_a ? a : b;
+    size_type &index = from_a ? ia : ib;
+    if (!out || out->count == chunk_capacity) {
+      Chunk *chunk = spare;
+      spare = spare->next;
+      chunk->count = 0;
+      chunk->next = nullptr;
+      (out ? out->next : first) = chunk;
+      out = chunk;
+    }
+    T &item = src->items()[index];
+    new (out->items() + out->count) T(std::move(item));
+    item.~T();
+    ++out->count;
+    if (++index == src->count) {
+      Chunk *done = src;
+      src = src->next;
+      index = 0;
+      done->count = 0;
+      done->next = spare;
+      spare = done;
+    }
+  }
+  return first;
+}
+
+template <typename T, size_t B>
+typename unrolled_list<T, B>::Chunk *
+unrolled_list<T, B>::new_chunk_after(Chunk *pos) {
+  Chunk *chunk = new Chunk;
+  chunk->count = 0;
+  chunk->prev = pos;
+  chunk->next = pos ? pos->next : head;
+  if (chunk->next)
+    chunk->next->prev = chunk;
+  else
+    tail = chunk;
+  if (pos)
+    pos->next = chunk;
+  else
+    head = chunk;
+  ++chunks;
+  return chunk;
+}
+
+template <typename T, size_t B>
+void unrolled_list<T, B>::delete_chunk(Chunk *chunk) noexcept {
+  if (chunk->prev)
+    chunk->prev->next = chunk->next;
+  else
+    head = chunk->next;
+  if (chunk->next)
+    chunk->next->prev = chunk->prev;
+  else
+    tail = chunk->prev;
+  delete chunk;
+  --chunks;
+} // delete_chunk(): чанк уже должен быть пустым
+
+// split переносит элементы [at, count) в новый чанк сразу после chunk
+template <typename T, size_t B>
+typename unrolled_list<T, B>::Chunk *
+unrolled_list<T, B>::split(Chunk *chunk, size_type at) {
+  Chunk *upper = new_chunk_after(chunk);
+  move_items(upper, chunk, at, chunk->count);
+  chunk->count = at;
+  return upper;
+}
+
+// после удаления соседние чанки сливаются, если вместе заняты не больше
+// чем на 3/4, — так вставки и удаления не делят и не сливают их по кругу
+template <typename T, size_t B>
+void unrolled_list<T, B>::rebalance(Chunk *chunk) {
+  const size_type limit = chunk_capacity * 3 / 4;
+  if (chunk->count == 0) {
+    delete_chunk(chunk);
+  } else if (chunk->prev && chunk->prev->count + chunk->count <= limit) {
+    move_items(chunk->prev, chunk, 0, chunk->count);
+    chunk->count = 0;
+    delete_chunk(chunk);
+  } else if (chunk->next && chunk->count + chunk->next->count <= limit) {
+    Chunk *next = chunk->next;
+    move_items(chunk, next, 0, next->count);
+    next->count = 0;
+    delete_chunk(next);
+  }
+}
+
+// move_items дописывает элементы from[first, last) в конец to
+template <typename T, size_t B>
+void unrolled_list<T, B>::move_items(Chunk *to, Chunk *from, size_type first,
+                                     size_type last) {
+  T *dst = to->items() + to->count;
+  T *src = from->items();
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    std::memcpy(static_cast<void *>(dst), src + first,
+                (last - first) * sizeof(T));
+  } else {
+    for (size_type i = first; i < last; ++i, ++dst) {
+      new (dst) T(std::move(src[i]));
+      src[i].~T();
+    }
+  }
+  to->count += last - first;
+}
+
+// open_gap сдвигает [at, count) на одну позицию вправо
+template <typename T, size_t B>
+void unrolled_list<T, B>::open_gap(Chunk *chunk, size_type at) {
+  T *items = chunk->items();
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    std::memmove(static_cast<void *>(items + at + 1), items + at,
+                 (chunk->count - at) * sizeof(T));
+  } else {
+    for (size_type i = chunk->count; i > at; --i) {
+      new (items + i) T(std::move(items[i - 1]));
+      items[i - 1].~T();
+    }
+  }
+}
+
+// close_gap сдвигает [at + 1, count) влево на место уже разрушенного at
+template <typename T, size_t B>
+void unrolled_list<T, B>::close_gap(Chunk *chunk, size_type at) {
+  T *items = chunk->items();
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    std::memmove(static_cast<void *>(items + at), items + at + 1,
+                 (chunk->count - at - 1) * sizeof(T));
+  } else {
+    for (size_type i = at; i + 1 < chunk->count; ++i) {
+      new (items + i) T(std::move(items[i + 1]));
+      items[i + 1].~T();
+    }
+  }
+}
+
+// drop_front сдвигает [n, count) к началу на место уже разрушенных [0, n)
+template <typename T, size_t B>
+void unrolled_list<T, B>::drop_front(Chunk *chunk, size_type n) {
+  if (n == 0)
+    return;
+  T *items = chunk->items();
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    std::memmove(static_cast<void *>(items), items + n,
+                 (chunk->count - n) * sizeof(T));
+  } else {
+    for (size_type i = n; i < chunk->count; ++i) {
+      new (items + i - n) T(std::move(items[i]));
+      items[i].~T();
+    }
+  }
+  chunk->count -= n;
+}
+
+} // namespace s21
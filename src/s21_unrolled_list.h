@@ -0,0 +1,121 @@
+#ifndef S21_UNROLLED_LIST_H_
+#define S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Развёрнутый список: каждый узел (чанк) хранит до chunk_capacity элементов
+// подряд, поэтому обход идёт по непрерывной памяти, а не по узлу на элемент.
+// Вставка и удаление сдвигают элементы внутри чанка, поэтому делают
+// недействительными итераторы на элементы; end() остаётся действительным.
+template <typename T, size_t ChunkBytes = 256> class unrolled_list {
+public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+private:
+  static constexpr size_type kHeader = 2 * sizeof(void *) + sizeof(size_type);
+  static constexpr size_type kFit =
+      ChunkBytes > kHeader ? (ChunkBytes - kHeader) / sizeof(T) : 0;
+
+public:
+  static constexpr size_type chunk_capacity = kFit < 4 ? 4 : kFit;
+
+  struct Chunk {
+    Chunk *next;
+    Chunk *prev;
+    size_type count;
+    alignas(T) unsigned char storage[chunk_capacity * sizeof(T)];
+    T *items() { return reinterpret_cast<T *>(storage); }
+  };
+
+  class Iterator {
+  public:
+    typedef std::ptrdiff_t difference_type;
+    unrolled_list *list_; // нужен, чтобы --end() нашёл последний чанк
+    Chunk *chunk_;
+    size_type index_;
+    explicit Iterator(unrolled_list *list, Chunk *chunk, size_type index = 0)
+        : list_(list), chunk_(chunk), index_(index){};
+    T &operator*();
+    Iterator &operator++();
+    Iterator &operator--();
+    bool operator==(const Iterator &other) const;
+    bool operator!=(const Iterator &other) const;
+  };
+
+  unrolled_list();
+  unrolled_list(std::initializer_list<T> const &items);
+  unrolled_list(const unrolled_list &other);
+  unrolled_list(unrolled_list &&other) noexcept;
+  ~unrolled_list();
+  unrolled_list &operator=(unrolled_list &&other) noexcept;
+  static size_t chunk_size() { return sizeof(Chunk); }
+
+  T &front();
+  const T &front() const;
+  T &back();
+  const T &back() const;
+
+  Iterator begin();
+  Iterator end();
+
+  bool empty() const;
+  size_t size() const;
+  size_t max_size() const;
+  size_t chunk_count() const;
+
+  void clear();
+  Iterator insert(Iterator pos, const T &value);
+  Iterator insert(Iterator pos, T &&value);
+  template <typename... Args> Iterator emplace(Iterator pos, Args &&...args);
+  void erase(Iterator pos);
+  void push_back(const T &value);
+  void push_back(T &&value);
+  void pop_back();
+  void push_front(const T &value);
+  void push_front(T &&value);
+  void pop_front();
+  void swap(unrolled_list &other) noexcept;
+  void splice(Iterator pos, unrolled_list &other);
+  void sort();
+  template <typename Compare> void sort(Compare comp);
+
+private:
+  Chunk *head;
+  Chunk *tail;
+  size_t length;
+  size_t chunks;
+
+  Chunk *new_chunk_after(Chunk *pos);
+  void delete_chunk(Chunk *chunk) noexcept;
+  Chunk *split(Chunk *chunk, size_type at);
+  void rebalance(Chunk *chunk);
+  static void move_items(Chunk *to, Chunk *from, size_type first,
+                         size_type last);
+  static void open_gap(Chunk *chunk, size_type at);
+  static void close_gap(Chunk *chunk, size_type at);
+  static void drop_front(Chunk *chunk, size_type n);
+  template <typename Compare>
+  static Chunk *sort_chunks(Chunk *first, size_type count, Chunk *&spare,
+                            Compare &comp);
+  template <typename Compare>
+  static Chunk *merge_chunks(Chunk *a, Chunk *b, Chunk *&spare,
+                             Compare &comp);
+};
+
+} // namespace s21
+
+#include "s21_unrolled_list.cpp"
+#endif // S21_UNROLLED_LIST_H_
@@ -127,7 +127,7 @@ template <typename T> void vector<T>::reserve(size_type size) {
     iterator temp = arr_;
     arr_ = new value_type[size];
     for (size_type i = 0; i < size_; i++) {
-      arr_[i] = temp[i];
+      arr_[i] = std::move(temp[i]);
     }
     delete[] temp;
     capacity_ = size;
@@ -167,6 +167,19 @@ template <typename T> void vector<T>::pop_back() {
   size_ -= 1;
 }
 
+// оставляет первые count элементов; ячейки массива из new[] живут до
+// delete[], поэтому отрезанные сбрасываются присваиванием value_type() и
+// сразу отдают свои ресурсы
+template <typename T> void vector<T>::truncate(size_type count) {
+  if (count > size_) {
+    throw std::length_error("Error: out of range memory");
+  }
+  for (size_type i = count; i < size_; ++i) {
+    arr_[i] = value_type();
+  }
+  size_ = count;
+}
+
 template <typename T> void vector<T>::push_back(const_reference value) {
   if (size_ >= capacity_) {
     if (capacity_ == 0) {
@@ -227,6 +240,44 @@ template <typename T> void vector<T>::erase(iterator pos) {
   size_ -= 1;
 }
 
+// value может лежать в самом векторе, поэтому сравнение идёт с копией
+template <typename T>
+typename vector<T>::size_type vector<T>::remove(const_reference value) {
+  if (&value >= arr_ && &value < arr_ + size_) {
+    value_type copy = value;
+    return remove_if([&copy](const_reference x) { return x == copy; });
+  }
+  return remove_if([&value](const_reference x) { return x == value; });
+}
+
+/**
+ * remove_if за один проход сдвигает оставшиеся элементы к началу
+ * перемещением, затем разом отрезает хвост через truncate: удалённые и
+ * опустевшие после перемещения элементы сразу отдают свои ресурсы.
+ */
+template <typename T>
+template <typename Predicate>
+typename vector<T>::size_type vector<T>::remove_if(Predicate pred) {
+  iterator last = arr_ + size_;
+  iterator out = arr_;
+  while (out != last && !pred(*out))
+    ++out;
+  if (out != last) {
+    for (iterator it = out + 1; it != last; ++it) {
+      if (!pred(*it))
+        *out++ = std::move(*it);
+    }
+  }
+  size_type removed = last - out;
+  truncate(out - arr_);
+  return removed;
+}
+
+template <typename T, typename Predicate>
+typename vector<T>::size_type erase_if(vector<T> &v, Predicate pred) {
+  return v.remove_if(pred);
+}
+
 template <typename T> void vector<T>::delV() {
   if (arr_ != nullptr) {
     delete[] arr_;
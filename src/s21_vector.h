@@ -50,11 +50,14 @@ public:
   void reduce();
   void clear();
   void pop_back();
+  void truncate(size_type count);
   void push_back(const_reference value);
   void swap(vector &other);
   void sort();
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
+  size_type remove(const_reference value);
+  template <typename Predicate> size_type remove_if(Predicate pred);
 
 private:
   iterator arr_;
@@ -63,6 +66,9 @@ private:
 
   void delV();
 };
+
+template <typename T, typename Predicate>
+typename vector<T>::size_type erase_if(vector<T> &v, Predicate pred);
 } // namespace s21
 
 #include "s21_vector.cpp"
@@ -1,6 +1,13 @@
 #include "s21_container.h"
 #include <gtest/gtest.h>
+#include <atomic>
+#include <iterator>
 #include <list>
+#include <map>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 
 TEST(ListTest, construct) {
   s21::List<int> list;
@@ -107,12 +114,6 @@ TEST(ListTest, merge_left) {
 
   delete right;
 }
-TEST(ListTest, get_middle_return) {
-  s21::List<int> list;
-  typename s21::List<int>::Node *result = list.get_middle(nullptr);
-
-  ASSERT_EQ(result, nullptr);
-}
 
 TEST(ListTest, pop_back_empty) {
   s21::List<int> list;
@@ -120,7 +121,9 @@ TEST(ListTest, pop_back_empty) {
   list.push_back(1);
   list.pop_back();
 
-  ASSERT_EQ(list.head, nullptr);
+  ASSERT_TRUE(list.begin() == list.end());
+  ASSERT_EQ(list.root_.next, &list.root_);
+  ASSERT_EQ(list.root_.prev, &list.root_);
 }
 TEST(ListTest, reverse) {
   s21::List<int> list = {1, 2, 3};
@@ -640,6 +643,1823 @@ TEST(ListTest, sort_origin) {
   }
 }
 
+TEST(ListTest, reserve_nodes) {
+  s21::List<int> list;
+  list.reserve_nodes(100);
+  auto pool = list.node_pool();
+  size_t slabs = pool->slab_count();
+  EXPECT_GE(pool->capacity(), 100);
+  for (int i = 0; i < 100; ++i)
+    list.push_back(i);
+  EXPECT_EQ(pool->slab_count(), slabs);
+  EXPECT_EQ(pool->in_use(), 100);
+  EXPECT_EQ(list.front(), 0);
+  EXPECT_EQ(list.back(), 99);
+}
+
+TEST(ListTest, pool_reuse) {
+  s21::List<int> list;
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 50; ++i)
+      list.push_back(i);
+    while (!list.empty())
+      list.pop_front();
+  }
+  EXPECT_EQ(list.node_pool()->in_use(), 0);
+  EXPECT_LE(list.node_pool()->capacity(), 64);
+}
+
+TEST(ListTest, pool_clear_release) {
+  s21::List<int> list = {1, 2, 3, 4, 5};
+  size_t capacity = list.node_pool()->capacity();
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.node_pool()->in_use(), 0);
+  list.push_back(7);
+  EXPECT_EQ(list.front(), 7);
+  EXPECT_EQ(list.node_pool()->capacity(), capacity);
+}
+
+TEST(ListTest, pool_shared) {
+  s21::List<std::string> list1;
+  s21::List<std::string> list2(list1.node_pool());
+  list1.push_back("one");
+  list2.push_back("two");
+  list2.push_back("three");
+  EXPECT_EQ(list1.node_pool(), list2.node_pool());
+  EXPECT_EQ(list1.node_pool()->in_use(), 3);
+  list1.clear();
+  EXPECT_EQ(list2.node_pool()->in_use(), 2);
+  EXPECT_EQ(list2.front(), "two");
+  EXPECT_EQ(list2.back(), "three");
+}
+
+TEST(ListTest, pool_insert_end_no_leak) {
+  s21::List<int> list = {1, 2};
+  list.insert(list.end(), 3);
+  EXPECT_EQ(list.node_pool()->in_use(), list.size());
+}
+
+struct MoveOnly {
+  explicit MoveOnly(int v) : value(v) {}
+  MoveOnly(const MoveOnly &) = delete;
+  MoveOnly &operator=(const MoveOnly &) = delete;
+  MoveOnly(MoveOnly &&other) noexcept : value(other.value) {}
+  int value;
+};
+
+TEST(ListTest, splice_move_only) {
+  s21::List<MoveOnly> listA;
+  s21::List<MoveOnly> listB;
+  listA.push_back(MoveOnly(1));
+  listA.push_back(MoveOnly(4));
+  listB.push_back(MoveOnly(2));
+  listB.push_front(MoveOnly(0));
+  auto it = listA.begin();
+  ++it;
+  listA.splice(it, listB);
+  EXPECT_EQ(listA.size(), 4);
+  EXPECT_TRUE(listB.empty());
+  int expected[] = {1, 0, 2, 4};
+  int i = 0;
+  for (auto &element : listA)
+    EXPECT_EQ(element.value, expected[i++]);
+  EXPECT_EQ(listA.back().value, 4);
+}
+
+TEST(ListTest, splice_keeps_nodes) {
+  s21::List<std::string> listA = {"a", "d"};
+  s21::List<std::string> listB = {"b", "c"};
+  std::string *b = &listB.front();
+  auto pos = listA.begin();
+  ++pos;
+  listA.splice(pos, listB);
+  auto it = listA.begin();
+  ++it;
+  EXPECT_EQ(&*it, b);
+  EXPECT_EQ(listA.node_pool(), listB.node_pool());
+}
+
+TEST(ListTest, splice_single) {
+  s21::List<MoveOnly> listA;
+  s21::List<MoveOnly> listB;
+  listA.push_back(MoveOnly(1));
+  listB.push_back(MoveOnly(2));
+  listB.push_back(MoveOnly(3));
+  auto it = listB.begin();
+  ++it;
+  listA.splice(listA.end(), listB, it);
+  EXPECT_EQ(listA.size(), 2);
+  EXPECT_EQ(listB.size(), 1);
+  EXPECT_EQ(listA.back().value, 3);
+  EXPECT_EQ(listB.back().value, 2);
+  listA.splice(listA.begin(), listA, ++listA.begin());
+  EXPECT_EQ(listA.front().value, 3);
+  EXPECT_EQ(listA.back().value, 1);
+}
+
+TEST(ListTest, splice_range) {
+  s21::List<int> listA = {1, 5};
+  s21::List<int> listB = {9, 2, 3, 4, 9};
+  auto first = listB.begin();
+  ++first;
+  auto last = first;
+  ++last, ++last, ++last;
+  auto pos = listA.begin();
+  ++pos;
+  listA.splice(pos, listB, first, last);
+  EXPECT_EQ(listA.size(), 5);
+  EXPECT_EQ(listB.size(), 2);
+  std::list<int> expected = {1, 2, 3, 4, 5};
+  auto it = listA.begin();
+  for (int value : expected) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_EQ(listB.front(), 9);
+  EXPECT_EQ(listB.back(), 9);
+  listA.splice(listA.end(), listB, listB.begin(), listB.end());
+  EXPECT_TRUE(listB.empty());
+  EXPECT_EQ(listA.size(), 7);
+  EXPECT_EQ(listA.back(), 9);
+}
+
+TEST(ListTest, splice_outlives_source) {
+  s21::List<std::string> listA = {"x"};
+  {
+    s21::List<std::string> listB = {"y", "z"};
+    s21::List<std::string> listC(listB.node_pool());
+    listC.push_back("w");
+    listA.splice(listA.end(), listB);
+    listC.push_back("v");
+    EXPECT_EQ(listC.node_pool(), listA.node_pool());
+    listA.splice(listA.begin(), listC);
+  }
+  EXPECT_EQ(listA.size(), 5);
+  EXPECT_EQ(listA.front(), "w");
+  EXPECT_EQ(listA.back(), "z");
+  EXPECT_EQ(listA.node_pool()->in_use(), 5);
+}
+
+TEST(ListTest, sort_large) {
+  s21::List<int> list;
+  std::list<int> std_list;
+  unsigned seed = 12345;
+  for (int i = 0; i < 300000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int value = static_cast<int>(seed >> 8) % 1000;
+    list.push_back(value);
+    std_list.push_back(value);
+  }
+  list.sort();
+  std_list.sort();
+  EXPECT_EQ(list.size(), std_list.size());
+  auto it = list.begin();
+  for (int value : std_list) {
+    ASSERT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_EQ(list.back(), std_list.back());
+}
+
+TEST(ListTest, sort_compare_stable) {
+  s21::List<std::pair<int, int>> list = {{2, 0}, {1, 1}, {2, 2},
+                                         {1, 3}, {3, 4}, {1, 5}};
+  list.sort([](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+    return a.first > b.first;
+  });
+  std::pair<int, int> expected[] = {{3, 4}, {2, 0}, {2, 2},
+                                    {1, 1}, {1, 3}, {1, 5}};
+  int i = 0;
+  for (auto &element : list)
+    EXPECT_EQ(element, expected[i++]);
+  EXPECT_EQ(list.back(), expected[5]);
+}
+
+TEST(ListTest, sort_prev_links) {
+  s21::List<int> list = {5, 3, 9, 1, 7, 2};
+  list.sort();
+  int expected[] = {9, 7, 5, 3, 2, 1};
+  int i = 0;
+  for (auto it = list.end(); it != list.begin();)
+    EXPECT_EQ(*--it, expected[i++]);
+  EXPECT_EQ(i, 6);
+}
+
+TEST(ListTest, merge_relink) {
+  s21::List<MoveOnly> list1;
+  s21::List<MoveOnly> list2;
+  for (int value : {1, 3, 3, 7})
+    list1.push_back(MoveOnly(value));
+  for (int value : {0, 3, 8})
+    list2.push_back(MoveOnly(value * 10));
+  MoveOnly *first = &list2.front();
+  list1.merge(list2, [](const MoveOnly &a, const MoveOnly &b) {
+    return a.value < b.value;
+  });
+  EXPECT_TRUE(list2.empty());
+  EXPECT_EQ(list1.size(), 7);
+  EXPECT_EQ(&list1.front(), first);
+  int expected[] = {0, 1, 3, 3, 7, 30, 80};
+  int i = 0;
+  for (auto &element : list1)
+    EXPECT_EQ(element.value, expected[i++]);
+  EXPECT_EQ(list1.back().value, 80);
+}
+
+TEST(ListTest, merge_stable) {
+  using Item = std::pair<int, char>;
+  s21::List<Item> list1 = {{1, 'a'}, {2, 'a'}, {4, 'a'}};
+  s21::List<Item> list2 = {{1, 'b'}, {4, 'b'}};
+  list1.merge(list2, [](const Item &a, const Item &b) {
+    return a.first < b.first;
+  });
+  Item expected[] = {{1, 'a'}, {1, 'b'}, {2, 'a'}, {4, 'a'}, {4, 'b'}};
+  int i = 0;
+  for (auto &element : list1)
+    EXPECT_EQ(element, expected[i++]);
+  EXPECT_EQ(list1.back(), expected[4]);
+  EXPECT_EQ(*--(--list1.end()), expected[3]);
+}
+
+TEST(ListTest, merge_no_allocation) {
+  s21::List<int> list1 = {1, 4, 9};
+  s21::List<int> list2 = {2, 3, 10, 11};
+  size_t slabs =
+      list1.node_pool()->slab_count() + list2.node_pool()->slab_count();
+  list1.merge(list2);
+  auto pool = list1.node_pool();
+  EXPECT_EQ(pool->slab_count(), slabs);
+  EXPECT_EQ(pool->in_use(), 7);
+  EXPECT_EQ(list1.back(), 11);
+}
+
+TEST(ListTest, splice_adopts_unused_pool_capacity) {
+  auto donor = std::make_shared<s21::List<int>::pool_type>(1000);
+  s21::List<int> list1 = {1, 2};
+  s21::List<int> list2(donor);
+  list2.push_back(3);
+  list2.push_back(4);
+  list2.pop_front();
+  list1.splice(list1.end(), list2);
+  auto pool = list1.node_pool();
+  size_t slabs = pool->slab_count();
+  while (pool->in_use() < pool->capacity())
+    list1.push_back(0);
+  EXPECT_EQ(pool->slab_count(), slabs);
+  EXPECT_EQ(list1.size(), pool->capacity());
+  EXPECT_EQ(*++(++list1.begin()), 4);
+}
+
+TEST(ListTest, reverse_iteration_from_end) {
+  s21::List<int> list = {1, 2, 3};
+  auto it = list.end();
+  --it;
+  EXPECT_EQ(*it, 3);
+  it = list.insert(list.end(), 4);
+  list.insert(list.begin(), 0);
+  list.erase(++list.begin());
+  int expected[] = {4, 3, 2, 0};
+  int i = 0;
+  for (it = list.end(); it != list.begin();)
+    EXPECT_EQ(*--it, expected[i++]);
+  EXPECT_EQ(i, 4);
+  ++it;
+  ++it;
+  ++it;
+  ++it;
+  EXPECT_TRUE(it == list.end()); // end() замыкает кольцо
+  ++it;
+  EXPECT_EQ(*it, 0);
+}
+
+TEST(ListTest, sentinel_after_swap_move) {
+  s21::List<std::string> list1 = {"a", "b"};
+  s21::List<std::string> list2;
+  list1.swap(list2);
+  EXPECT_TRUE(list1.begin() == list1.end());
+  EXPECT_EQ(*--list2.end(), "b");
+  s21::List<std::string> list3(std::move(list2));
+  EXPECT_TRUE(list2.begin() == list2.end());
+  list3.push_front("0");
+  list3.push_back("c");
+  std::string expected[] = {"c", "b", "a", "0"};
+  int i = 0;
+  for (auto it = list3.end(); it != list3.begin();)
+    EXPECT_EQ(*--it, expected[i++]);
+  list2 = std::move(list3);
+  EXPECT_EQ(list2.back(), "c");
+  EXPECT_EQ(*--list2.end(), "c");
+}
+
+TEST(ListTest, sentinel_links_after_relink) {
+  s21::List<int> list1 = {5, 1, 4, 1};
+  s21::List<int> list2 = {3, 3, 9};
+  list1.sort();
+  list1.unique();
+  list1.merge(list2);
+  list1.reverse();
+  list1.splice(list1.end(), list2);
+  int expected[] = {9, 5, 4, 3, 3, 1};
+  int i = 5;
+  for (auto it = list1.end(); it != list1.begin();)
+    EXPECT_EQ(*--it, expected[i--]);
+  EXPECT_EQ(i, -1);
+  list1.pop_back();
+  list1.pop_front();
+  EXPECT_EQ(*--list1.end(), 3);
+  EXPECT_EQ(*++list1.end(), 5);
+}
+
+TEST(ListTest, remove_if) {
+  s21::List<int> list = {1, 2, 3, 4, 5, 6, 7};
+  size_t slabs = list.node_pool()->slab_count();
+  EXPECT_EQ(list.remove_if([](int value) { return value % 2 == 0; }), 3);
+  EXPECT_EQ(list.size(), 4);
+  EXPECT_EQ(list.node_pool()->in_use(), 4);
+  int expected[] = {1, 3, 5, 7};
+  int i = 0;
+  for (int value : list)
+    EXPECT_EQ(value, expected[i++]);
+  EXPECT_EQ(*--list.end(), 7);
+  EXPECT_EQ(s21::erase_if(list, [](int value) { return value > 100; }), 0);
+  EXPECT_EQ(s21::erase_if(list, [](int) { return true; }), 4);
+  EXPECT_TRUE(list.begin() == list.end());
+  list.push_back(8);
+  EXPECT_EQ(list.node_pool()->slab_count(), slabs);
+}
+
+TEST(ListTest, remove_aliased_value) {
+  s21::List<std::string> list = {"a", "b", "a", "c", "a"};
+  EXPECT_EQ(list.remove(list.front()), 3);
+  EXPECT_EQ(list.size(), 2);
+  EXPECT_EQ(list.front(), "b");
+  EXPECT_EQ(list.back(), "c");
+  EXPECT_EQ(list.remove("x"), 0);
+}
+
+TEST(ListTest, remove_if_throwing_predicate) {
+  s21::List<int> list = {1, 2, 3, 4};
+  auto pred = [](int value) {
+    if (value == 3)
+      throw std::runtime_error("predicate");
+    return value == 2;
+  };
+  EXPECT_THROW(list.remove_if(pred), std::runtime_error);
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.node_pool()->in_use(), 3);
+  EXPECT_EQ(list.back(), 4);
+}
+
+TEST(ListTest, insert_many) {
+  s21::List<int> list = {1, 5};
+  auto it = list.insert_many(++list.begin(), 2, 3, 4);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(list.size(), 5);
+  list.insert_many_back(6, 7);
+  list.insert_many_front(-1, 0);
+  int expected[] = {-1, 0, 1, 2, 3, 4, 5, 6, 7};
+  int i = 0;
+  for (int value : list)
+    EXPECT_EQ(value, expected[i++]);
+  EXPECT_EQ(i, 9);
+  EXPECT_EQ(*--list.end(), 7);
+  EXPECT_TRUE(list.insert_many(list.end()) == list.end());
+  list.insert_many_back();
+  EXPECT_EQ(list.size(), 9);
+}
+
+TEST(ListTest, insert_many_one_slab) {
+  s21::List<std::string> list;
+  std::string moved = "moved";
+  list.insert_many_back("a", std::string("b"), moved, std::move(moved));
+  EXPECT_EQ(list.size(), 4);
+  EXPECT_EQ(list.node_pool()->slab_count(), 1);
+  EXPECT_EQ(list.back(), "moved");
+  s21::List<std::string> pushed;
+  for (int i = 0; i < 100; ++i) {
+    list.insert_many(list.begin(), "x", "y", "z");
+    for (int j = 0; j < 3; ++j)
+      pushed.push_back("x");
+  }
+  // мелкие пачки растят пул слабами того же размера, что и push_back
+  EXPECT_LE(list.node_pool()->slab_count(), pushed.node_pool()->slab_count());
+  s21::List<MoveOnly> move_only;
+  move_only.insert_many_front(MoveOnly(1), MoveOnly(2));
+  EXPECT_EQ(move_only.front().value, 1);
+  EXPECT_EQ(move_only.back().value, 2);
+}
+
+TEST(ListTest, insert_many_throw) {
+  struct Fragile {
+    int value;
+    Fragile(int v) : value(v) {
+      if (v < 0)
+        throw std::invalid_argument("negative");
+    }
+  };
+  s21::List<Fragile> list;
+  list.push_back(Fragile(1));
+  EXPECT_THROW(list.insert_many_back(2, 3, -1, 4), std::invalid_argument);
+  EXPECT_EQ(list.size(), 1);
+  EXPECT_EQ(list.node_pool()->in_use(), 1);
+  EXPECT_EQ(list.back().value, 1);
+  EXPECT_EQ((*--list.end()).value, 1);
+}
+
+// s21_unrolled_list tests ---------------------------------------
+
+TEST(UnrolledListTest, construct) {
+  s21::unrolled_list<int> list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.size(), 0);
+  EXPECT_TRUE(list.begin() == list.end());
+}
+
+TEST(UnrolledListTest, push_pop) {
+  s21::unrolled_list<int, 64> list;
+  std::list<int> std_list;
+  for (int i = 0; i < 100; ++i) {
+    list.push_back(i);
+    list.push_front(-i);
+    std_list.push_back(i);
+    std_list.push_front(-i);
+  }
+  EXPECT_EQ(list.size(), std_list.size());
+  EXPECT_GT(list.chunk_count(), 1);
+  list.pop_front();
+  list.pop_back();
+  std_list.pop_front();
+  std_list.pop_back();
+  EXPECT_EQ(list.front(), std_list.front());
+  EXPECT_EQ(list.back(), std_list.back());
+  auto it = list.begin();
+  for (int value : std_list) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_TRUE(it == list.end());
+}
+
+TEST(UnrolledListTest, insert_middle_split) {
+  s21::unrolled_list<int, 64> list;
+  std::list<int> std_list;
+  for (int i = 0; i < 10; ++i) {
+    list.push_back(i);
+    std_list.push_back(i);
+  }
+  auto it = list.begin();
+  auto std_it = std_list.begin();
+  for (int i = 0; i < 5; ++i)
+    ++it, ++std_it;
+  for (int i = 0; i < 200; ++i) {
+    it = list.insert(it, 100 + i);
+    std_it = std_list.insert(std_it, 100 + i);
+  }
+  EXPECT_EQ(*it, 299);
+  EXPECT_EQ(list.size(), std_list.size());
+  auto check = list.begin();
+  for (int value : std_list) {
+    EXPECT_EQ(*check, value);
+    ++check;
+  }
+}
+
+TEST(UnrolledListTest, erase_merge) {
+  s21::unrolled_list<std::string, 128> list;
+  for (int i = 0; i < 100; ++i)
+    list.push_back(std::to_string(i));
+  size_t chunks = list.chunk_count();
+  for (int i = 0; i < 90; ++i)
+    list.erase(list.begin());
+  EXPECT_EQ(list.size(), 10);
+  EXPECT_LT(list.chunk_count(), chunks);
+  EXPECT_EQ(list.front(), "90");
+  EXPECT_EQ(list.back(), "99");
+  auto it = list.begin();
+  ++it;
+  --it;
+  EXPECT_EQ(*it, "90");
+}
+
+TEST(UnrolledListTest, copy_move) {
+  s21::unrolled_list<int> list1 = {1, 2, 3};
+  s21::unrolled_list<int> list2(list1);
+  s21::unrolled_list<int> list3(std::move(list1));
+  EXPECT_TRUE(list1.empty());
+  EXPECT_EQ(list2.size(), 3);
+  EXPECT_EQ(list3.back(), 3);
+  list2 = std::move(list3);
+  EXPECT_EQ(list2.size(), 3);
+  EXPECT_EQ(list2.front(), 1);
+}
+
+TEST(UnrolledListTest, splice) {
+  s21::unrolled_list<int, 64> listA;
+  s21::unrolled_list<int, 64> listB;
+  for (int i = 0; i < 20; ++i)
+    listA.push_back(i < 10 ? i : i + 20);
+  for (int i = 10; i < 30; ++i)
+    listB.push_back(i);
+  auto pos = listA.begin();
+  for (int i = 0; i < 10; ++i)
+    ++pos;
+  listA.splice(pos, listB);
+  EXPECT_TRUE(listB.empty());
+  EXPECT_EQ(listA.size(), 40);
+  int expected = 0;
+  for (auto &element : listA)
+    EXPECT_EQ(element, expected++);
+}
+
+TEST(UnrolledListTest, sort) {
+  s21::unrolled_list<int, 64> list;
+  std::list<int> std_list;
+  unsigned seed = 7;
+  for (int i = 0; i < 1000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    list.push_back(static_cast<int>(seed >> 16));
+    std_list.push_back(static_cast<int>(seed >> 16));
+  }
+  list.sort();
+  std_list.sort();
+  auto it = list.begin();
+  for (int value : std_list) {
+    ASSERT_EQ(*it, value);
+    ++it;
+  }
+  list.sort(std::greater<int>());
+  EXPECT_EQ(list.front(), std_list.back());
+  EXPECT_EQ(list.back(), std_list.front());
+}
+
+TEST(UnrolledListTest, insert_element_of_same_list) {
+  s21::unrolled_list<int> list = {1, 2, 3};
+  list.insert(list.begin(), list.back());
+  int expected[] = {3, 1, 2, 3};
+  int i = 0;
+  for (int value : list)
+    EXPECT_EQ(value, expected[i++]);
+
+  s21::unrolled_list<std::string, 128> strings;
+  for (int i = 0; i < 20; ++i)
+    strings.push_back(std::string(40, static_cast<char>('a' + i)));
+  strings.push_front(strings.back());
+  EXPECT_EQ(strings.front(), std::string(40, 't'));
+  auto it = strings.begin();
+  ++it;
+  strings.insert(it, *++strings.begin());
+  EXPECT_EQ(*++strings.begin(), std::string(40, 'a'));
+  EXPECT_EQ(strings.size(), 22);
+}
+
+TEST(UnrolledListTest, decrement_end) {
+  s21::unrolled_list<int, 64> list;
+  for (int i = 0; i < 40; ++i)
+    list.push_back(i);
+  auto it = list.end();
+  for (int i = 39; i >= 0; --i)
+    EXPECT_EQ(*--it, i);
+  EXPECT_TRUE(it == list.begin());
+  EXPECT_EQ(*--list.end(), 39);
+}
+
+TEST(UnrolledListTest, sort_is_stable_and_compacts) {
+  using Item = std::pair<int, int>;
+  using ItemList = s21::unrolled_list<Item, 64>;
+  ItemList list;
+  for (int i = 300; i > 0; --i) // вставки в начало оставляют чанки наполовину
+    list.push_front({(i * 37) % 10, i});
+  size_t size = list.size();
+  EXPECT_GT(list.chunk_count(), size / ItemList::chunk_capacity + 1);
+  list.sort([](const Item &a, const Item &b) { return a.first < b.first; });
+  EXPECT_EQ(list.size(), size);
+  const size_t per_chunk = ItemList::chunk_capacity;
+  EXPECT_EQ(list.chunk_count(), (size + per_chunk - 1) / per_chunk);
+  Item previous{-1, -1};
+  size_t count = 0;
+  for (auto &item : list) {
+    EXPECT_TRUE(previous.first < item.first ||
+                (previous.first == item.first &&
+                 previous.second < item.second));
+    previous = item;
+    ++count;
+  }
+  EXPECT_EQ(count, size);
+  EXPECT_EQ(*--list.end(), list.back());
+}
+
+TEST(UnrolledListTest, sort_throwing_comparator_keeps_elements) {
+  for (int limit : {5, 200, 800, 1200}) {
+    s21::unrolled_list<std::string> list;
+    for (int i = 0; i < 300; ++i) // перестановка 0..299
+      list.push_back(std::to_string(i * 119 % 300));
+    int calls = 0;
+    auto comp = [&calls, limit](const std::string &a, const std::string &b) {
+      if (++calls == limit)
+        throw std::runtime_error("compare");
+      return a < b;
+    };
+    EXPECT_THROW(list.sort(comp), std::runtime_error);
+    ASSERT_EQ(list.size(), 300);
+    std::map<std::string, int> seen;
+    for (auto &item : list)
+      ++seen[item];
+    ASSERT_EQ(seen.size(), 300);
+    size_t backward = 0;
+    for (auto it = list.end(); it != list.begin(); --it)
+      ++backward;
+    EXPECT_EQ(backward, 300);
+    list.sort();
+    EXPECT_EQ(list.front(), "0");
+    EXPECT_EQ(list.back(), "99");
+  }
+}
+
+TEST(UnrolledListTest, move_only) {
+  s21::unrolled_list<MoveOnly, 64> list;
+  for (int i = 0; i < 50; ++i)
+    list.push_front(MoveOnly(i));
+  list.insert(list.begin(), MoveOnly(100));
+  EXPECT_EQ(list.front().value, 100);
+  EXPECT_EQ(list.back().value, 0);
+}
+
+// s21_intrusive_list tests --------------------------------------
+
+struct Session {
+  explicit Session(int session_id) : id(session_id) {}
+  int id;
+  s21::intrusive_list_hook hook;
+};
+
+using SessionList = s21::intrusive_list<Session, &Session::hook>;
+
+TEST(IntrusiveListTest, push_pop) {
+  Session a(1), b(2), c(3);
+  SessionList list;
+  EXPECT_TRUE(list.empty());
+  list.push_back(b);
+  list.push_back(c);
+  list.push_front(a);
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(&list.front(), &a);
+  EXPECT_EQ(&list.back(), &c);
+  EXPECT_TRUE(b.hook.is_linked());
+  list.pop_front();
+  list.pop_back();
+  EXPECT_EQ(list.size(), 1);
+  EXPECT_FALSE(a.hook.is_linked());
+  EXPECT_EQ(list.front().id, 2);
+  list.pop_back();
+  EXPECT_THROW(list.pop_front(), std::out_of_range);
+}
+
+TEST(IntrusiveListTest, iterate_both_ways) {
+  Session sessions[] = {Session(1), Session(2), Session(3)};
+  SessionList list;
+  for (auto &session : sessions)
+    list.push_back(session);
+  int expected = 1;
+  for (auto &session : list)
+    EXPECT_EQ(session.id, expected++);
+  auto it = list.end();
+  --it;
+  EXPECT_EQ(it->id, 3);
+  --it;
+  EXPECT_EQ((*it).id, 2);
+}
+
+TEST(IntrusiveListTest, erase_by_reference) {
+  Session a(1), b(2), c(3);
+  SessionList list;
+  list.push_back(a);
+  list.push_back(b);
+  list.push_back(c);
+  list.erase(b);
+  EXPECT_EQ(list.size(), 2);
+  EXPECT_FALSE(b.hook.is_linked());
+  EXPECT_EQ(&*++list.begin(), &c);
+  list.push_back(b);
+  EXPECT_EQ(&list.back(), &b);
+}
+
+TEST(IntrusiveListTest, splice) {
+  Session s[] = {Session(0), Session(1), Session(2), Session(3), Session(4)};
+  SessionList listA, listB;
+  listA.push_back(s[0]);
+  listA.push_back(s[4]);
+  listB.push_back(s[1]);
+  listB.push_back(s[2]);
+  listB.push_back(s[3]);
+  listA.splice(--listA.end(), listB, listB.begin(), --listB.end());
+  EXPECT_EQ(listA.size(), 4);
+  EXPECT_EQ(listB.size(), 1);
+  listA.splice(--listA.end(), listB, listB.begin());
+  EXPECT_TRUE(listB.empty());
+  int expected = 0;
+  for (auto &session : listA)
+    EXPECT_EQ(session.id, expected++);
+  listB.splice(listB.end(), listA);
+  EXPECT_TRUE(listA.empty());
+  EXPECT_EQ(listB.size(), 5);
+  EXPECT_EQ(&listB.back(), &s[4]);
+}
+
+TEST(IntrusiveListTest, move_swap_clear) {
+  Session a(1), b(2);
+  SessionList list1;
+  list1.push_back(a);
+  SessionList list2(std::move(list1));
+  EXPECT_TRUE(list1.empty());
+  EXPECT_EQ(&list2.front(), &a);
+  list1.push_back(b);
+  list1.swap(list2);
+  EXPECT_EQ(&list1.front(), &a);
+  EXPECT_EQ(&list2.front(), &b);
+  list1 = std::move(list2);
+  EXPECT_EQ(&list1.front(), &b);
+  EXPECT_FALSE(a.hook.is_linked());
+  list1.clear();
+  EXPECT_FALSE(b.hook.is_linked());
+  EXPECT_TRUE(list1.begin() == list1.end());
+}
+
+#if S21_INTRUSIVE_SAFE_MODE
+TEST(IntrusiveListTest, safe_mode_double_insert) {
+  Session a(1);
+  SessionList list1, list2;
+  list1.push_back(a);
+  EXPECT_THROW(list1.push_back(a), std::logic_error);
+  EXPECT_THROW(list2.push_front(a), std::logic_error);
+  EXPECT_EQ(list1.size(), 1);
+  EXPECT_TRUE(list2.empty());
+}
+
+TEST(IntrusiveListTest, safe_mode_erase_unlinked) {
+  Session a(1), b(2);
+  SessionList list;
+  list.push_back(a);
+  EXPECT_THROW(list.erase(b), std::logic_error);
+  list.erase(a);
+  EXPECT_THROW(list.erase(a), std::logic_error);
+  EXPECT_TRUE(list.empty());
+}
+#endif
+
+// копия бросает, когда кончается бюджет; перемещение не noexcept
+struct CopyBomb {
+  static int budget;
+  static int live;
+  explicit CopyBomb(int v) : value(v) { ++live; }
+  CopyBomb(const CopyBomb &other) : value(other.value) {
+    if (budget >= 0 && budget-- == 0)
+      throw std::runtime_error("copy");
+    ++live;
+  }
+  CopyBomb(CopyBomb &&other) : value(other.value) { ++live; }
+  ~CopyBomb() { --live; }
+  CopyBomb &operator=(const CopyBomb &) = default;
+  int value;
+};
+int CopyBomb::budget = -1;
+int CopyBomb::live = 0;
+
+// s21_compact_list tests ----------------------------------------
+
+TEST(CompactListTest, construct) {
+  s21::compact_list<int> list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_TRUE(list.begin() == list.end());
+  auto it = list.end();
+  --it;
+  EXPECT_TRUE(it == list.end());
+  s21::compact_list<double> sized(5);
+  EXPECT_EQ(sized.size(), 5);
+  EXPECT_GE(sized.capacity(), 5);
+}
+
+TEST(CompactListTest, slot_size) {
+  EXPECT_EQ(s21::compact_list<int>::slot_size(), 12);
+  EXPECT_LT(s21::compact_list<int>::slot_size(), s21::List<int>::node_size());
+}
+
+TEST(CompactListTest, push_pop_origin) {
+  s21::compact_list<int> list = {2, 3};
+  std::list<int> std_list = {2, 3};
+  for (int i = 0; i < 100; ++i) {
+    list.push_back(i);
+    list.push_front(-i);
+    std_list.push_back(i);
+    std_list.push_front(-i);
+  }
+  list.pop_back();
+  list.pop_front();
+  std_list.pop_back();
+  std_list.pop_front();
+  EXPECT_EQ(list.size(), std_list.size());
+  EXPECT_EQ(list.front(), std_list.front());
+  EXPECT_EQ(list.back(), std_list.back());
+  auto it = list.begin();
+  for (int value : std_list) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_TRUE(it == list.end());
+  --it;
+  EXPECT_EQ(*it, std_list.back());
+}
+
+TEST(CompactListTest, insert_erase_reuse) {
+  s21::compact_list<std::string> list = {"a", "c"};
+  auto it = list.begin();
+  ++it;
+  it = list.insert(it, "b");
+  EXPECT_EQ(*it, "b");
+  size_t capacity = list.capacity();
+  list.erase(it);
+  list.push_back("d");
+  list.insert(list.begin(), "0");
+  list.erase(list.begin());
+  EXPECT_EQ(list.capacity(), capacity);
+  std::string expected[] = {"a", "c", "d"};
+  int i = 0;
+  for (auto &element : list)
+    EXPECT_EQ(element, expected[i++]);
+  EXPECT_THROW(s21::compact_list<int>().pop_front(), std::out_of_range);
+}
+
+TEST(CompactListTest, iterator_survives_growth) {
+  s21::compact_list<std::string> list;
+  list.push_back("first");
+  auto it = list.begin();
+  for (int i = 0; i < 1000; ++i)
+    list.push_back(std::to_string(i));
+  EXPECT_EQ(*it, "first");
+  list.push_back(list.front());
+  EXPECT_EQ(list.back(), "first");
+  EXPECT_EQ(list.size(), 1002);
+}
+
+TEST(CompactListTest, copy_move) {
+  s21::compact_list<int> list1 = {1, 2, 3, 4};
+  list1.erase(++list1.begin());
+  s21::compact_list<int> list2(list1);
+  list2.push_back(5);
+  int expected[] = {1, 3, 4, 5};
+  int i = 0;
+  for (auto &element : list2)
+    EXPECT_EQ(element, expected[i++]);
+  EXPECT_EQ(list1.size(), 3);
+  s21::compact_list<std::string> strings1 = {"x", "y"};
+  s21::compact_list<std::string> strings2(strings1);
+  s21::compact_list<std::string> strings3(std::move(strings1));
+  EXPECT_TRUE(strings1.empty());
+  EXPECT_EQ(strings2.back(), "y");
+  EXPECT_EQ(strings3.front(), "x");
+  strings2 = std::move(strings3);
+  EXPECT_EQ(strings2.size(), 2);
+}
+
+TEST(CompactListTest, clear_keeps_capacity) {
+  s21::compact_list<int> list;
+  list.reserve(100);
+  size_t capacity = list.capacity();
+  for (int i = 0; i < 100; ++i)
+    list.push_back(i);
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.capacity(), capacity);
+  list.push_back(1);
+  EXPECT_EQ(list.front(), 1);
+  EXPECT_EQ(list.back(), 1);
+}
+
+TEST(CompactListTest, grow_rolls_back_on_throw) {
+  CopyBomb::live = 0;
+  {
+    s21::compact_list<CopyBomb> list;
+    int next = 0;
+    do {
+      list.push_back(CopyBomb(next++));
+    } while (list.size() < list.capacity());
+    list.erase(++++list.begin()); // свободная ячейка посреди массива
+    size_t capacity = list.capacity();
+    auto check = [&] {
+      EXPECT_EQ(CopyBomb::live, next - 1);
+      int expected = 0;
+      for (auto &item : list) {
+        EXPECT_EQ(item.value, expected);
+        expected += expected == 1 ? 2 : 1;
+      }
+      EXPECT_EQ(expected, next);
+    };
+    CopyBomb::budget = 5; // перемещение не noexcept, поэтому grow копирует
+    EXPECT_THROW(list.reserve(capacity * 2), std::runtime_error);
+    EXPECT_EQ(list.capacity(), capacity);
+    check();
+    CopyBomb::budget = -1;
+    list.reserve(capacity * 2);
+    EXPECT_GE(list.capacity(), capacity * 2);
+    check();
+
+    while (list.size() < list.capacity())
+      list.push_back(CopyBomb(next++)); // первым занимает освобождённую
+    capacity = list.capacity();
+    CopyBomb::budget = 20;
+    EXPECT_THROW(list.push_back(CopyBomb(next)), std::runtime_error);
+    CopyBomb::budget = -1;
+    EXPECT_EQ(list.capacity(), capacity);
+    EXPECT_EQ(list.size(), capacity);
+    EXPECT_EQ(CopyBomb::live, static_cast<int>(capacity));
+  }
+  EXPECT_EQ(CopyBomb::live, 0);
+}
+
+// s21_lru_cache tests -------------------------------------------
+
+TEST(LruCacheTest, get_put) {
+  s21::lru_cache<int, std::string> cache(2);
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.get(1), nullptr);
+  EXPECT_TRUE(cache.put(1, "one"));
+  EXPECT_TRUE(cache.put(2, "two"));
+  ASSERT_NE(cache.get(1), nullptr);
+  EXPECT_EQ(*cache.get(1), "one");
+  EXPECT_TRUE(cache.put(3, "three")); // вытесняется 2
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_TRUE(cache.contains(3));
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.hits(), 2);
+  EXPECT_EQ(cache.misses(), 1);
+  EXPECT_EQ(cache.evictions(), 1);
+  cache.reset_stats();
+  EXPECT_EQ(cache.hits() + cache.misses() + cache.evictions(), 0);
+  EXPECT_THROW((s21::lru_cache<int, int>(0)), std::invalid_argument);
+}
+
+TEST(LruCacheTest, update_touch_peek) {
+  s21::lru_cache<std::string, int> cache(3);
+  cache.put("a", 1);
+  cache.put("b", 2);
+  cache.put("c", 3);
+  cache.put("a", 10); // обновление делает запись свежей
+  EXPECT_EQ(*cache.peek("b"), 2);
+  EXPECT_TRUE(cache.touch("b"));
+  EXPECT_FALSE(cache.touch("x"));
+  cache.put("d", 4); // самая старая теперь c
+  EXPECT_FALSE(cache.contains("c"));
+  EXPECT_EQ(*cache.peek("a"), 10);
+  EXPECT_EQ(cache.size(), 3);
+  EXPECT_EQ(cache.hits(), 0);
+  EXPECT_TRUE(cache.erase("a"));
+  EXPECT_FALSE(cache.erase("a"));
+  EXPECT_EQ(cache.size(), 2);
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.get("b"), nullptr);
+}
+
+TEST(LruCacheTest, byte_limit) {
+  s21::lru_cache<int, std::string> cache(100, 10);
+  EXPECT_TRUE(cache.put(1, "aaaa", 4));
+  EXPECT_TRUE(cache.put(2, "bbbb", 4));
+  EXPECT_EQ(cache.bytes(), 8);
+  EXPECT_TRUE(cache.put(3, "cc", 2));
+  EXPECT_EQ(cache.size(), 3);
+  EXPECT_TRUE(cache.put(4, "ddd", 3)); // вытесняется 1
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_EQ(cache.bytes(), 9);
+  EXPECT_TRUE(cache.put(2, "b", 1));
+  EXPECT_EQ(cache.bytes(), 6);
+  EXPECT_FALSE(cache.put(2, "too large", 11));
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_EQ(cache.bytes(), 5);
+  EXPECT_EQ(cache.max_bytes(), 10);
+}
+
+TEST(LruCacheTest, eviction_callback) {
+  s21::lru_cache<int, std::string> cache(2);
+  std::vector<std::pair<int, std::string>> evicted;
+  cache.set_eviction_callback([&evicted](const int &key, std::string &value) {
+    evicted.emplace_back(key, std::move(value));
+  });
+  cache.put(1, "one");
+  cache.put(2, "two");
+  cache.get(1);
+  cache.put(3, "three");
+  cache.put(4, "four");
+  cache.erase(4); // erase — не вытеснение
+  ASSERT_EQ(evicted.size(), 2);
+  EXPECT_EQ(evicted[0], std::make_pair(2, std::string("two")));
+  EXPECT_EQ(evicted[1], std::make_pair(1, std::string("one")));
+}
+
+TEST(LruCacheTest, index_survives_churn) {
+  struct BadHash {
+    size_t operator()(int key) const { return key % 4; }
+  };
+  s21::lru_cache<int, int, BadHash> cache(64);
+  std::list<int> order; // эталон: от свежих к старым
+  unsigned seed = 1;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 16) % 200;
+    if (seed & 1) {
+      cache.put(key, key * 2);
+      order.remove(key);
+      order.push_front(key);
+      if (order.size() > 64)
+        order.pop_back();
+    } else if (cache.get(key)) {
+      EXPECT_EQ(*cache.peek(key), key * 2);
+      order.remove(key);
+      order.push_front(key);
+    }
+  }
+  EXPECT_EQ(cache.size(), order.size());
+  for (int key : order)
+    EXPECT_TRUE(cache.contains(key));
+  EXPECT_FALSE(cache.contains(1000));
+}
+
+TEST(LruCacheTest, steady_state_eviction) {
+  s21::lru_cache<int, int> cache(128);
+  for (int i = 0; i < 128; ++i)
+    cache.put(i, i);
+  for (int i = 128; i < 10000; ++i)
+    cache.put(i, i);
+  EXPECT_EQ(cache.size(), 128);
+  EXPECT_EQ(cache.evictions(), 10000 - 128);
+  EXPECT_TRUE(cache.contains(9999));
+  EXPECT_FALSE(cache.contains(9871));
+  EXPECT_TRUE(cache.contains(9872));
+}
+
+// s21_flat_map tests --------------------------------------------------------
+
+TEST(FlatMapTest, insert_find_erase) {
+  s21::flat_map<int, std::string> map = {{3, "c"}, {1, "a"}, {2, "b"}};
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.begin()->first, 1);
+  EXPECT_TRUE(map.insert({0, "zero"}).second);
+  EXPECT_FALSE(map.insert({2, "again"}).second);
+  EXPECT_EQ(map.at(2), "b");
+  EXPECT_THROW(map.at(10), std::out_of_range);
+  map[5] = "e";
+  EXPECT_EQ(map.find(4), map.end());
+  EXPECT_EQ(map.find(5)->second, "e");
+  EXPECT_FALSE(map.insert_or_assign(5, "five").second);
+  EXPECT_EQ(map.at(5), "five");
+  EXPECT_EQ(map.lower_bound(4)->first, 5);
+  EXPECT_EQ(map.upper_bound(2)->first, 3);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  map.erase(map.find(3));
+  int expected[] = {0, 2, 5};
+  int i = 0;
+  for (const auto &item : map)
+    EXPECT_EQ(item.first, expected[i++]);
+  EXPECT_EQ(i, 3);
+  map.erase(map.begin(), map.end());
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(FlatMapTest, bulk_insert_matches_std_map) {
+  s21::flat_map<int, int> map;
+  std::map<int, int> expected;
+  unsigned seed = 5;
+  for (int round = 0; round < 20; ++round) {
+    std::list<std::pair<int, int>> batch;
+    for (int i = 0; i < 300; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      batch.push_back({static_cast<int>(seed >> 16) % 2000, round * 1000 + i});
+    }
+    map.insert(batch.begin(), batch.end());
+    for (auto &item : batch)
+      expected.insert(item); // первый из равных ключей остаётся
+    map.try_emplace(round, -round);
+    expected.try_emplace(round, -round);
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  auto it = expected.begin();
+  for (const auto &item : map) {
+    EXPECT_EQ(item.first, it->first);
+    EXPECT_EQ(item.second, it->second);
+    ++it;
+  }
+  for (int key = -1; key <= 2000; ++key)
+    ASSERT_EQ(map.contains(key), expected.count(key) == 1) << key;
+}
+
+TEST(FlatMapTest, sorted_range_merge_and_transparent_lookup) {
+  std::pair<std::string, int> items[] = {{"a", 1}, {"b", 2}, {"b", 3}};
+  s21::flat_map<std::string, int, std::less<>> map(
+      s21::assume_sorted, std::begin(items), std::end(items));
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(std::string_view("b")), 2);
+  EXPECT_TRUE(map.contains("a"));
+  EXPECT_EQ(map.lower_bound("aa")->first, "b");
+  s21::flat_map<std::string, int, std::less<>> other = {{"b", 20}, {"c", 30}};
+  map.merge(other);
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at("b"), 2);
+  ASSERT_EQ(other.size(), 1);
+  EXPECT_EQ(other.begin()->first, "b");
+  EXPECT_EQ(other.begin()->second, 20);
+}
+
+TEST(FlatMapTest, shrinking_releases_values) {
+  auto shared = std::make_shared<int>(1);
+  s21::flat_map<int, std::shared_ptr<int>> map;
+  for (int i = 0; i < 6; ++i)
+    map.try_emplace(i, shared);
+  EXPECT_EQ(map.erase(0), 1);
+  map.erase(map.begin(), map.begin() + 2);
+  EXPECT_EQ(shared.use_count(), 4);
+  std::pair<int, std::shared_ptr<int>> batch[] = {
+      {3, shared}, {10, shared}, {10, shared}};
+  map.insert(std::begin(batch), std::end(batch));
+  for (auto &item : batch)
+    item.second.reset();
+  EXPECT_EQ(shared.use_count(), 5); // 3, 4, 5 и один 10
+  s21::flat_map<int, std::shared_ptr<int>> other;
+  other.try_emplace(4, shared);
+  other.try_emplace(20, shared);
+  map.merge(other);
+  EXPECT_EQ(other.size(), 1);
+  EXPECT_EQ(shared.use_count(), 7);
+  map.clear();
+  other.clear();
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(FlatMapTest, iterators_keep_keys_const) {
+  using Map = s21::flat_map<int, std::string>;
+  static_assert(!std::is_assignable_v<decltype((Map::iterator()->first)),
+                                      int>);
+  static_assert(!std::is_assignable_v<decltype(*Map::iterator()),
+                                      std::pair<int, std::string>>);
+  static_assert(!std::is_assignable_v<
+                decltype((Map::const_iterator()->second)), std::string>);
+  Map map = {{1, "a"}, {2, "b"}, {3, "c"}};
+  map.find(2)->second = "two";
+  (*map.begin()).second += "!";
+  map.begin()[2].second = "three";
+  EXPECT_EQ(map.at(1), "a!");
+  EXPECT_EQ(map.at(2), "two");
+  EXPECT_EQ(map.at(3), "three");
+  const Map &view = map;
+  Map::const_iterator it = map.begin();
+  EXPECT_EQ(it, view.begin());
+  EXPECT_EQ(view.end() - it, 3);
+  EXPECT_EQ((it + 2)->first, 3);
+  EXPECT_EQ(std::prev(view.end())->second, "three");
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 3);
+}
+
+// s21_flat_set tests --------------------------------------------------------
+
+TEST(FlatSetTest, shrinking_releases_keys) {
+  using Ptr = std::shared_ptr<int>;
+  Ptr items[] = {std::make_shared<int>(0), std::make_shared<int>(1),
+                 std::make_shared<int>(2), std::make_shared<int>(3)};
+  s21::flat_set<Ptr> set(std::begin(items), std::end(items));
+  set.insert(std::begin(items), std::end(items)); // все повторы
+  for (auto &item : items)
+    EXPECT_EQ(item.use_count(), 2);
+  set.erase(items[0]);
+  set.erase(set.find(items[1]));
+  EXPECT_EQ(items[0].use_count(), 1);
+  EXPECT_EQ(items[1].use_count(), 1);
+  s21::flat_set<Ptr> other = {items[2], items[0]};
+  set.merge(other);
+  EXPECT_EQ(other.size(), 1);
+  EXPECT_EQ(items[0].use_count(), 2);
+  EXPECT_EQ(items[2].use_count(), 3);
+  set.clear();
+  other.clear();
+  for (auto &item : items)
+    EXPECT_EQ(item.use_count(), 1);
+}
+
+TEST(FlatSetTest, insert_find_erase) {
+  s21::flat_set<int> set = {5, 1, 3, 1};
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_TRUE(set.insert(2).second);
+  EXPECT_FALSE(set.insert(3).second);
+  EXPECT_TRUE(set.contains(2));
+  EXPECT_EQ(set.find(4), set.end());
+  EXPECT_EQ(*set.lower_bound(4), 5);
+  EXPECT_EQ(*set.upper_bound(1), 2);
+  EXPECT_EQ(set.erase(1), 1);
+  set.erase(set.find(5));
+  int expected[] = {2, 3};
+  int i = 0;
+  for (int value : set)
+    EXPECT_EQ(value, expected[i++]);
+  EXPECT_EQ(i, 2);
+}
+
+TEST(FlatSetTest, bulk_insert_and_merge) {
+  s21::flat_set<int, std::greater<int>> set;
+  std::list<int> batch = {4, 9, 1, 9, 7};
+  set.insert(batch.begin(), batch.end());
+  set.insert(batch.begin(), batch.end());
+  int expected[] = {9, 7, 4, 1};
+  int i = 0;
+  for (int value : set)
+    EXPECT_EQ(value, expected[i++]);
+  EXPECT_EQ(i, 4);
+  s21::flat_set<int, std::greater<int>> other = {10, 7, 0};
+  set.merge(other);
+  EXPECT_EQ(set.size(), 6);
+  EXPECT_EQ(*set.begin(), 10);
+  ASSERT_EQ(other.size(), 1);
+  EXPECT_EQ(*other.begin(), 7);
+  std::list<std::string> sorted = {"ann", "bob", "bob", "eve"};
+  s21::flat_set<std::string, std::less<>> names(s21::assume_sorted,
+                                                sorted.begin(), sorted.end());
+  EXPECT_EQ(names.size(), 3);
+  EXPECT_TRUE(names.contains(std::string_view("bob")));
+}
+
+// s21_unordered_map tests ---------------------------------------------------
+
+// сводит ключи к нескольким хешам, чтобы цепочки были длинными
+struct ClusterHash {
+  size_t operator()(int key) const { return static_cast<size_t>(key % 5); }
+};
+
+struct StringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view key) const {
+    return std::hash<std::string_view>()(key);
+  }
+};
+
+TEST(UnorderedMapTest, insert_find_erase) {
+  s21::unordered_map<int, std::string> map = {{1, "one"}, {2, "two"}};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.insert({3, "three"}).second);
+  EXPECT_FALSE(map.insert({1, "uno"}).second);
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_THROW(map.at(4), std::out_of_range);
+  map[4] = "four";
+  EXPECT_EQ(map.find(4)->second, "four");
+  EXPECT_EQ(map.find(5), map.end());
+  EXPECT_FALSE(map.insert_or_assign(2, "dos").second);
+  EXPECT_EQ(map.at(2), "dos");
+  EXPECT_FALSE(map.try_emplace(3, "tres").second);
+  EXPECT_TRUE(map.emplace(5, "five").second);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  map.erase(map.find(3));
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_FALSE(map.contains(3));
+  int sum = 0;
+  for (auto &item : map)
+    sum += item.first;
+  EXPECT_EQ(sum, 2 + 4 + 5);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+struct HashBomb {
+  static int budget;
+  size_t operator()(int key) const {
+    if (budget >= 0 && budget-- == 0)
+      throw std::runtime_error("hash");
+    return static_cast<size_t>(key);
+  }
+};
+int HashBomb::budget = -1;
+
+TEST(UnorderedMapTest, rehash_rolls_back_on_throw) {
+  s21::unordered_map<int, CopyBomb> copies;
+  for (int i = 0; i < 14; ++i)
+    copies.try_emplace(i, CopyBomb(i));
+  CopyBomb::budget = 5;
+  EXPECT_THROW(copies.try_emplace(14, CopyBomb(14)), std::runtime_error);
+  CopyBomb::budget = -1;
+  EXPECT_EQ(copies.size(), 14);
+  for (int i = 0; i < 14; ++i)
+    EXPECT_EQ(copies.find(i)->second.value, i);
+
+  s21::unordered_map<int, std::string, HashBomb> hashes;
+  for (int i = 0; i < 14; ++i)
+    hashes.try_emplace(i, std::string(40, static_cast<char>('a' + i)));
+  HashBomb::budget = 5;
+  EXPECT_THROW(hashes.try_emplace(14, "x"), std::runtime_error);
+  HashBomb::budget = -1;
+  EXPECT_EQ(hashes.size(), 14);
+  for (int i = 0; i < 14; ++i)
+    EXPECT_EQ(hashes.at(i), std::string(40, static_cast<char>('a' + i)));
+}
+
+TEST(UnorderedMapTest, random_operations_match_std_map) {
+  s21::unordered_map<int, int, ClusterHash> map;
+  std::map<int, int> expected;
+  unsigned seed = 7;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 16) % 600;
+    if (seed & 0x100) {
+      map.insert_or_assign(key, i);
+      expected[key] = i;
+    } else {
+      ASSERT_EQ(map.erase(key), expected.erase(key)) << i;
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+  for (int key = 0; key < 600; ++key) {
+    auto it = expected.find(key);
+    ASSERT_EQ(map.contains(key), it != expected.end()) << key;
+    if (it != expected.end()) {
+      EXPECT_EQ(map.at(key), it->second);
+    }
+  }
+  size_t visited = 0;
+  for (auto &item : map) {
+    EXPECT_EQ(expected.at(item.first), item.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, expected.size());
+}
+
+TEST(UnorderedMapTest, erase_shifts_without_tombstones) {
+  s21::unordered_map<int, int, ClusterHash> map;
+  map.reserve(100);
+  size_t buckets = map.bucket_count();
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 80; ++i)
+      map[round * 100 + i] = i;
+    for (int i = 0; i < 80; ++i)
+      ASSERT_EQ(map.erase(round * 100 + i), 1);
+  }
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.bucket_count(), buckets);
+  EXPECT_GE(buckets * 7 / 8, 100);
+}
+
+TEST(UnorderedMapTest, transparent_lookup_and_move_only_values) {
+  s21::unordered_map<std::string, int, StringHash, std::equal_to<>> names;
+  names["alice"] = 1;
+  names.try_emplace("bob", 2);
+  EXPECT_TRUE(names.contains(std::string_view("alice")));
+  EXPECT_EQ(names.at(std::string_view("bob")), 2);
+  EXPECT_EQ(names.count("carol"), 0);
+  EXPECT_EQ(names.find("bob")->second, 2);
+
+  s21::unordered_map<int, MoveOnly> owned;
+  for (int i = 0; i < 100; ++i)
+    owned.try_emplace(i, i * 2);
+  EXPECT_EQ(owned.at(42).value, 84);
+  EXPECT_FALSE(owned.try_emplace(42, 0).second);
+}
+
+TEST(UnorderedMapTest, copy_move_and_merge) {
+  s21::unordered_map<std::string, int> map;
+  for (int i = 0; i < 200; ++i)
+    map[std::to_string(i)] = i;
+  s21::unordered_map<std::string, int> copy(map);
+  copy.erase("7");
+  EXPECT_EQ(map.at("7"), 7);
+  EXPECT_EQ(copy.size(), 199);
+  s21::unordered_map<std::string, int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 199);
+  EXPECT_EQ(moved.at("150"), 150);
+  map = moved;
+  EXPECT_FALSE(map.contains("7"));
+
+  s21::unordered_map<std::string, int> other = {{"7", -7}, {"8", -8}};
+  map.merge(other);
+  EXPECT_EQ(map.size(), 200);
+  EXPECT_EQ(map.at("7"), -7);
+  EXPECT_EQ(map.at("8"), 8);
+  ASSERT_EQ(other.size(), 1);
+  EXPECT_EQ(other.begin()->first, "8");
+}
+
+// s21_unordered_set tests ---------------------------------------------------
+
+TEST(UnorderedSetTest, insert_find_erase_merge) {
+  s21::unordered_set<int, ClusterHash> set = {5, 1, 3, 1};
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_TRUE(set.insert(2).second);
+  EXPECT_FALSE(set.emplace(3).second);
+  EXPECT_EQ(*set.find(2), 2);
+  EXPECT_EQ(set.find(4), set.end());
+  EXPECT_EQ(set.erase(1), 1);
+  set.erase(set.find(5));
+  EXPECT_EQ(set.size(), 2);
+  s21::unordered_set<int, ClusterHash> other;
+  for (int i = 0; i < 300; ++i)
+    other.insert(i);
+  set.merge(other);
+  EXPECT_EQ(set.size(), 300);
+  EXPECT_EQ(other.size(), 2);
+  EXPECT_TRUE(other.contains(2) && other.contains(3));
+
+  s21::unordered_set<std::string, StringHash, std::equal_to<>> words = {"ab"};
+  EXPECT_TRUE(words.contains(std::string_view("ab")));
+  EXPECT_EQ(words.count("cd"), 0);
+}
+
+// s21_concurrent_map tests --------------------------------------------------
+
+TEST(ConcurrentMapTest, single_thread_operations) {
+  s21::concurrent_map<std::string, int> map(5);
+  EXPECT_EQ(map.shard_count(), 8);
+  EXPECT_TRUE(map.insert("a", 1));
+  EXPECT_FALSE(map.insert("a", 2));
+  EXPECT_EQ(map.find("a").value(), 1);
+  EXPECT_FALSE(map.find("b").has_value());
+  EXPECT_TRUE(map.insert_or_assign("b", 2));
+  EXPECT_FALSE(map.insert_or_assign("b", 3));
+  EXPECT_EQ(map.find("b").value(), 3);
+  int calls = 0;
+  EXPECT_EQ(map.compute_if_absent("c", [&] { return ++calls * 10; }), 10);
+  EXPECT_EQ(map.compute_if_absent("c", [&] { return ++calls * 10; }), 10);
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(map.erase("a"), 1);
+  EXPECT_EQ(map.erase("a"), 0);
+  EXPECT_EQ(map.size(), 2);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(ConcurrentMapTest, batch_operations) {
+  s21::concurrent_map<int, int> map(16);
+  std::pair<int, int> items[200];
+  for (int i = 0; i < 200; ++i)
+    items[i] = {i, i * 3};
+  EXPECT_EQ(map.insert_many(std::begin(items), std::end(items)), 200);
+  EXPECT_EQ(map.insert_many(std::begin(items), std::begin(items) + 10), 0);
+  int keys[] = {5, 500, 199, -1, 0};
+  std::optional<int> found[5];
+  map.find_many(std::begin(keys), std::end(keys), found);
+  EXPECT_EQ(found[0].value(), 15);
+  EXPECT_FALSE(found[1].has_value());
+  EXPECT_EQ(found[2].value(), 597);
+  EXPECT_FALSE(found[3].has_value());
+  EXPECT_EQ(found[4].value(), 0);
+  EXPECT_EQ(map.erase_many(std::begin(keys), std::end(keys)), 3);
+  EXPECT_EQ(map.size(), 197);
+}
+
+TEST(ConcurrentMapTest, parallel_writers_and_readers) {
+  s21::concurrent_map<int, int> map(8);
+  std::atomic<int> computed{0};
+  s21::vector<std::thread> threads(4);
+  for (int t = 0; t < 4; ++t) {
+    threads[t] = std::thread([&map, &computed, t] {
+      for (int i = 0; i < 2000; ++i) {
+        map.insert(100000 + t * 10000 + i, i);
+        map.compute_if_absent(i % 100, [&computed] {
+          ++computed;
+          return 1;
+        });
+        if (i % 2)
+          map.erase(100000 + t * 10000 + i - 1);
+        map.find(i);
+      }
+    });
+  }
+  for (int t = 0; t < 4; ++t)
+    threads[t].join();
+  EXPECT_EQ(computed.load(), 100);
+  EXPECT_EQ(map.size(), 4 * 1000 + 100);
+  for (int t = 0; t < 4; ++t) {
+    EXPECT_EQ(map.find(100000 + t * 10000 + 1).value(), 1);
+    EXPECT_FALSE(map.contains(100000 + t * 10000 + 2));
+  }
+}
+
+// s21_persistent_map tests --------------------------------------------------
+
+// считает живые объекты и копии, чтобы проверить разделение узлов
+struct Counted {
+  static int live;
+  static int copies;
+  explicit Counted(int v = 0) : value(v) { ++live; }
+  Counted(const Counted &other) : value(other.value) {
+    ++live;
+    ++copies;
+  }
+  ~Counted() { --live; }
+  Counted &operator=(const Counted &) = delete;
+  int value;
+};
+int Counted::live = 0;
+int Counted::copies = 0;
+
+TEST(PersistentMapTest, versions_are_independent) {
+  s21::persistent_map<int, std::string> empty;
+  auto one = empty.insert(1, "one");
+  auto two = one.insert(2, "two");
+  auto renamed = two.insert_or_assign(1, "uno");
+  auto erased = renamed.erase(2);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(one.size(), 1);
+  EXPECT_EQ(one.at(1), "one");
+  EXPECT_FALSE(one.contains(2));
+  EXPECT_EQ(two.at(1), "one");
+  EXPECT_EQ(renamed.at(1), "uno");
+  EXPECT_EQ(renamed.size(), 2);
+  EXPECT_EQ(erased.size(), 1);
+  EXPECT_EQ(erased.count(2), 0);
+  EXPECT_EQ(two.find(2)->second, "two");
+  EXPECT_EQ(two.find(3), two.end());
+  EXPECT_THROW(erased.at(2), std::out_of_range);
+  EXPECT_EQ(two.insert(1, "x").at(1), "one");
+  s21::persistent_map<int, std::string> snapshot = renamed;
+  renamed = renamed.erase(1);
+  EXPECT_EQ(snapshot.at(1), "uno");
+  EXPECT_TRUE(renamed.contains(2) && !renamed.contains(1));
+}
+
+TEST(PersistentMapTest, random_versions_match_std_map) {
+  s21::persistent_map<int, int> map;
+  std::map<int, int> expected;
+  s21::vector<s21::persistent_map<int, int>> versions;
+  s21::vector<std::map<int, int>> expected_versions;
+  unsigned seed = 11;
+  for (int i = 0; i < 3000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 16) % 500;
+    if (seed & 0x300) {
+      map = map.insert_or_assign(key, i);
+      expected[key] = i;
+    } else {
+      map = map.erase(key);
+      expected.erase(key);
+    }
+    if (i % 300 == 0) {
+      versions.push_back(map);
+      expected_versions.push_back(expected);
+    }
+  }
+  versions.push_back(map);
+  expected_versions.push_back(expected);
+  for (size_t v = 0; v < versions.size(); ++v) {
+    ASSERT_EQ(versions[v].size(), expected_versions[v].size());
+    auto it = expected_versions[v].begin();
+    for (auto &item : versions[v]) {
+      EXPECT_EQ(item.first, it->first);
+      EXPECT_EQ(item.second, it->second);
+      ++it;
+    }
+    EXPECT_EQ(it, expected_versions[v].end());
+  }
+}
+
+TEST(PersistentMapTest, throwing_copy_releases_partial_path) {
+  s21::persistent_map<int, CopyBomb> map;
+  for (int i = 0; i < 200; ++i)
+    map = map.insert(i, CopyBomb(i));
+  int live = CopyBomb::live;
+  for (int budget = 0; budget < 12; ++budget) {
+    CopyBomb::budget = budget;
+    try {
+      auto inserted = map.insert(1000 + budget, CopyBomb(0));
+      EXPECT_EQ(inserted.size(), 201);
+    } catch (const std::runtime_error &) {
+    }
+    CopyBomb::budget = budget;
+    try {
+      auto erased = map.erase(budget * 17);
+      EXPECT_EQ(erased.size(), 199);
+    } catch (const std::runtime_error &) {
+    }
+    CopyBomb::budget = -1;
+    EXPECT_EQ(CopyBomb::live, live);
+  }
+  EXPECT_EQ(map.size(), 200);
+  for (int i = 0; i < 200; ++i)
+    EXPECT_EQ(map.at(i).value, i);
+}
+
+TEST(PersistentMapTest, updates_copy_only_the_path) {
+  {
+    s21::persistent_map<int, Counted> map;
+    for (int i = 0; i < 1024; ++i)
+      map = map.insert(i, Counted(i));
+    EXPECT_EQ(Counted::live, 1024);
+    Counted::copies = 0;
+    auto next = map.insert_or_assign(500, Counted(-1));
+    // путь в AVL-дереве из 1024 узлов не длиннее 15 узлов
+    EXPECT_LE(Counted::copies, 2 * 15);
+    EXPECT_EQ(next.at(500).value, -1);
+    EXPECT_EQ(map.at(500).value, 500);
+    Counted::copies = 0;
+    auto smaller = next.erase(10);
+    EXPECT_LE(Counted::copies, 2 * 15);
+    map = smaller;
+    next = smaller;
+    EXPECT_EQ(Counted::live, 1023);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
+
+// s21_rcu_map tests ---------------------------------------------------------
+
+TEST(RcuMapTest, readers_see_published_versions) {
+  s21::rcu_map<int, std::string> map(2);
+  auto reader = map.register_reader();
+  EXPECT_FALSE(reader.find(1).has_value());
+  map.insert_or_assign(1, "one");
+  map.insert_or_assign(2, "two");
+  EXPECT_EQ(reader.find(1).value(), "one");
+  auto before = reader.snapshot();
+  EXPECT_TRUE(map.erase(1));
+  EXPECT_FALSE(map.erase(1));
+  EXPECT_FALSE(reader.contains(1));
+  EXPECT_EQ(before.at(1), "one");
+  map.update([](s21::persistent_map<int, std::string> &version) {
+    version = version.insert_or_assign(3, "three").erase(2);
+  });
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(reader.read([](const s21::persistent_map<int, std::string> &v) {
+    return v.begin()->second;
+  }), "three");
+  auto second = map.register_reader();
+  EXPECT_THROW(map.register_reader(), std::length_error);
+  EXPECT_EQ(second.find(3).value(), "three");
+}
+
+TEST(RcuMapTest, versions_wait_for_active_readers) {
+  s21::rcu_map<int, int> map;
+  auto reader = map.register_reader();
+  map.insert_or_assign(1, 1);
+  EXPECT_EQ(map.retired(), 0);
+  reader.read([&map](const s21::persistent_map<int, int> &version) {
+    map.insert_or_assign(1, 2);
+    map.insert_or_assign(1, 3);
+    // версию, которую видит читатель, освобождать нельзя
+    EXPECT_EQ(map.retired(), 2);
+    EXPECT_EQ(version.at(1), 1);
+    return 0;
+  });
+  map.reclaim();
+  EXPECT_EQ(map.retired(), 0);
+  EXPECT_EQ(reader.find(1).value(), 3);
+}
+
+TEST(RcuMapTest, parallel_readers_see_consistent_versions) {
+  s21::rcu_map<int, int> map;
+  map.update([](s21::persistent_map<int, int> &version) {
+    version = version.insert(0, 0).insert(1, 0);
+  });
+  std::atomic<bool> stop{false};
+  std::atomic<int> torn{0};
+  s21::vector<std::thread> readers(3);
+  for (int t = 0; t < 3; ++t) {
+    readers[t] = std::thread([&] {
+      auto reader = map.register_reader();
+      while (!stop.load()) {
+        reader.read([&torn](const s21::persistent_map<int, int> &v) {
+          if (v.at(0) != v.at(1))
+            ++torn;
+          return 0;
+        });
+      }
+    });
+  }
+  for (int i = 1; i <= 2000; ++i) {
+    map.update([i](s21::persistent_map<int, int> &version) {
+      version = version.insert_or_assign(0, i).insert_or_assign(1, i);
+    });
+  }
+  stop = true;
+  for (int t = 0; t < 3; ++t)
+    readers[t].join();
+  EXPECT_EQ(torn.load(), 0);
+  map.reclaim();
+  EXPECT_EQ(map.retired(), 0);
+}
+
+// s21_concurrent_skiplist_map tests -----------------------------------------
+
+TEST(ConcurrentSkiplistMapTest, ordered_operations) {
+  s21::concurrent_skiplist_map<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert(5, "five"));
+  EXPECT_TRUE(map.insert(1, "one"));
+  EXPECT_TRUE(map.insert(3, "three"));
+  EXPECT_FALSE(map.insert(3, "tres"));
+  EXPECT_EQ(map.find(3)->second, "three");
+  EXPECT_EQ(map.find(4), map.end());
+  EXPECT_EQ(map.lower_bound(2)->first, 3);
+  EXPECT_EQ(map.upper_bound(3)->first, 5);
+  EXPECT_EQ(map.upper_bound(5), map.end());
+  EXPECT_TRUE(map.erase(3));
+  EXPECT_FALSE(map.erase(3));
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_TRUE(map.insert(3, "again"));
+  int expected[] = {1, 3, 5};
+  int i = 0;
+  for (auto &item : map)
+    EXPECT_EQ(item.first, expected[i++]);
+  EXPECT_EQ(i, 3);
+  EXPECT_EQ(map.size(), 3);
+}
+
+TEST(ConcurrentSkiplistMapTest, random_operations_match_std_map) {
+  s21::concurrent_skiplist_map<int, int> map;
+  std::map<int, int> expected;
+  unsigned seed = 13;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 16) % 700;
+    if (seed & 0x100)
+      ASSERT_EQ(map.insert(key, i), expected.insert({key, i}).second);
+    else
+      ASSERT_EQ(map.erase(key), expected.erase(key) == 1);
+  }
+  auto it = expected.begin();
+  for (auto &item : map) {
+    ASSERT_NE(it, expected.end());
+    EXPECT_EQ(item.first, it->first);
+    EXPECT_EQ(item.second, it->second);
+    ++it;
+  }
+  EXPECT_EQ(it, expected.end());
+}
+
+TEST(ConcurrentSkiplistMapTest, parallel_inserts_erases_and_scans) {
+  s21::concurrent_skiplist_map<int, std::string> map;
+  std::atomic<bool> unordered{false};
+  s21::vector<std::thread> threads(4);
+  for (int t = 0; t < 4; ++t) {
+    threads[t] = std::thread([&map, &unordered, t] {
+      for (int i = 0; i < 3000; ++i) {
+        map.insert(i * 4 + t, std::to_string(i));
+        map.insert(100000 + i, std::to_string(t)); // общие ключи
+        if (i % 3 == 0)
+          map.erase(i * 4 + t);
+        if (i % 500 == 0) {
+          int previous = -1;
+          for (auto &item : map) {
+            if (item.first <= previous)
+              unordered = true;
+            previous = item.first;
+          }
+        }
+      }
+    });
+  }
+  for (int t = 0; t < 4; ++t)
+    threads[t].join();
+  EXPECT_FALSE(unordered.load());
+  EXPECT_EQ(map.size(), 4 * 2000 + 3000);
+  for (int t = 0; t < 4; ++t) {
+    EXPECT_EQ(map.find(4 + t)->second, "1");
+    EXPECT_FALSE(map.contains(t));
+  }
+}
+
+TEST(ConcurrentSkiplistMapTest, iterator_keeps_erased_node_alive) {
+  Counted::live = 0;
+  {
+    s21::concurrent_skiplist_map<int, Counted> map;
+    for (int i = 0; i < 10; ++i)
+      map.insert(i, Counted(i));
+    {
+      auto it = map.find(5);
+      EXPECT_TRUE(map.erase(5));
+      s21::epoch_domain::instance().collect();
+      EXPECT_EQ(Counted::live, 10);
+      EXPECT_EQ(it->second.value, 5);
+    }
+    s21::epoch_domain::instance().collect();
+    EXPECT_EQ(Counted::live, 9);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
+
+TEST(ConcurrentSkiplistMapTest, end_iterators_do_not_pin_epoch) {
+  Counted::live = 0;
+  {
+    s21::concurrent_skiplist_map<int, Counted> map;
+    for (int i = 0; i < 10; ++i)
+      map.insert(i, Counted(i));
+    auto end = map.end();
+    decltype(end) empty;
+    auto walked = map.begin();
+    while (walked != end)
+      ++walked;
+    auto missing = map.find(42);
+    EXPECT_TRUE(map.erase(5));
+    s21::epoch_domain::instance().collect();
+    EXPECT_EQ(Counted::live, 9);
+    EXPECT_TRUE(walked == empty && missing == end);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
+
 // s21_queue tests -----------------------------------------------
 
 TEST(QueueTest, constructor) {
@@ -1160,6 +2980,523 @@ TEST(MapTest, map_erase_both) {
   EXPECT_TRUE(map.contains(7));
 }
 
+// чёрная высота поддерева или -1, если нарушены свойства красно-чёрного
+// дерева, порядок ключей или ссылки на родителя
+template <typename Node> int rb_black_height(const Node *node) {
+  if (!node)
+    return 1;
+  for (const Node *child : {node->left, node->right}) {
+    if (child && (child->parent != node || (node->red && child->red)))
+      return -1;
+  }
+  if ((node->left && !(node->left->data.first < node->data.first)) ||
+      (node->right && !(node->data.first < node->right->data.first)))
+    return -1;
+  int left = rb_black_height(node->left);
+  int right = rb_black_height(node->right);
+  if (left < 0 || left != right)
+    return -1;
+  return left + (node->red ? 0 : 1);
+}
+
+TEST(MapTest, balanced_on_sorted_keys) {
+  s21::Map<int, int> map;
+  const int n = 100000;
+  for (int i = 0; i < n; ++i)
+    map.insert({i, i});
+  EXPECT_EQ(map.size(), n);
+  EXPECT_FALSE(map.root_->red);
+  int black_height = rb_black_height(map.root_);
+  ASSERT_GT(black_height, 0);
+  EXPECT_LE(black_height, 18); // не больше log2(n + 1) + 1
+  EXPECT_EQ(map.at(n - 1), n - 1);
+  int expected = 0;
+  for (auto &item : map)
+    EXPECT_EQ(item.first, expected++);
+  for (int i = n - 1; i >= 0; i -= 2)
+    map.erase(map.find(i));
+  EXPECT_EQ(map.size(), n / 2);
+  EXPECT_GT(rb_black_height(map.root_), 0);
+}
+
+TEST(MapTest, random_insert_erase_keeps_invariants) {
+  s21::Map<int, int> map;
+  std::map<int, int> std_map;
+  unsigned seed = 3;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 16) % 1000;
+    if (seed & 0x100) {
+      map.insert({key, i});
+      std_map.insert({key, i});
+    } else if (map.contains(key)) {
+      map.erase(map.find(key));
+      std_map.erase(key);
+    }
+    if (i % 1000 == 0) {
+      ASSERT_GT(rb_black_height(map.root_), 0);
+    }
+  }
+  ASSERT_GT(rb_black_height(map.root_), 0);
+  ASSERT_EQ(map.size(), std_map.size());
+  auto it = std_map.begin();
+  for (auto &item : map) {
+    EXPECT_EQ(item.first, it->first);
+    EXPECT_EQ(item.second, it->second);
+    ++it;
+  }
+  while (!map.empty())
+    map.erase(map.begin());
+  EXPECT_EQ(map.root_, nullptr);
+}
+
+TEST(MapTest, custom_compare) {
+  s21::Map<int, std::string, std::greater<int>> map = {
+      {1, "one"}, {3, "three"}, {2, "two"}};
+  int expected[] = {3, 2, 1};
+  int i = 0;
+  for (auto &item : map)
+    EXPECT_EQ(item.first, expected[i++]);
+  EXPECT_FALSE(map.insert({2, "again"}).second);
+  EXPECT_EQ(map.at(2), "two");
+  EXPECT_EQ(map.count(3), 1);
+  EXPECT_EQ(map.count(4), 0);
+  EXPECT_TRUE(map.key_comp()(2, 1));
+}
+
+// ключ, который считает свои конструирования, и прозрачный компаратор к нему
+struct CountedKey {
+  static int constructed;
+  int id;
+  CountedKey(int value) : id(value) { ++constructed; }
+  CountedKey(const CountedKey &other) : id(other.id) { ++constructed; }
+};
+int CountedKey::constructed = 0;
+
+struct CountedLess {
+  using is_transparent = void;
+  int *calls;
+  bool operator()(const CountedKey &a, const CountedKey &b) const {
+    ++*calls;
+    return a.id < b.id;
+  }
+  bool operator()(const CountedKey &a, int b) const {
+    ++*calls;
+    return a.id < b;
+  }
+  bool operator()(int a, const CountedKey &b) const {
+    ++*calls;
+    return a < b.id;
+  }
+};
+
+TEST(MapTest, transparent_lookup) {
+  int calls = 0;
+  s21::Map<CountedKey, int, CountedLess> map(CountedLess{&calls});
+  for (int i = 0; i < 1023; ++i)
+    map.insert({CountedKey(i), i * 10});
+  CountedKey::constructed = 0;
+  calls = 0;
+  EXPECT_EQ(map.at(500), 5000);
+  EXPECT_LE(calls, 21); // высота не больше 20, плюс проверка равенства
+  EXPECT_TRUE(map.contains(1022));
+  EXPECT_FALSE(map.contains(1023));
+  EXPECT_EQ(map.count(-1), 0);
+  EXPECT_NE(map.find(7), nullptr);
+  EXPECT_THROW(map.at(2000), std::out_of_range);
+  EXPECT_EQ(CountedKey::constructed, 0);
+}
+
+TEST(MapTest, string_view_lookup) {
+  s21::Map<std::string, int, std::less<>> map = {{"alpha", 1}, {"beta", 2}};
+  std::string_view view = "beta";
+  EXPECT_EQ(map.at(view), 2);
+  EXPECT_TRUE(map.contains("alpha"));
+  EXPECT_FALSE(map.contains(std::string_view("gamma")));
+  EXPECT_EQ(map.count("alpha"), 1);
+  EXPECT_EQ(map.find("beta")->data.second, 2);
+}
+
+struct Tracked {
+  static int constructed;
+  static int copied;
+  Tracked() : value(0) { ++constructed; }
+  explicit Tracked(int v) : value(v) { ++constructed; }
+  Tracked(const Tracked &other) : value(other.value) { ++copied; }
+  Tracked(Tracked &&other) noexcept : value(other.value) {}
+  Tracked &operator=(const Tracked &other) {
+    value = other.value;
+    ++copied;
+    return *this;
+  }
+  Tracked &operator=(Tracked &&other) noexcept {
+    value = other.value;
+    return *this;
+  }
+  int value;
+};
+int Tracked::constructed = 0;
+int Tracked::copied = 0;
+
+TEST(MapTest, try_emplace_builds_value_once) {
+  s21::Map<int, Tracked> map;
+  Tracked::constructed = Tracked::copied = 0;
+  auto [it, inserted] = map.try_emplace(1, 10);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it->second.value, 10);
+  EXPECT_FALSE(map.try_emplace(1, 20).second);
+  EXPECT_EQ(map.at(1).value, 10);
+  map[1].value = 11;
+  map[2];
+  EXPECT_EQ(Tracked::constructed, 2); // повтор и map[1] значение не строят
+  EXPECT_EQ(Tracked::copied, 0);
+  EXPECT_EQ(map.size(), 2);
+}
+
+TEST(MapTest, rvalue_insert_and_emplace_move) {
+  s21::Map<std::string, MoveOnly> map;
+  EXPECT_TRUE(map.insert({"one", MoveOnly(1)}).second);
+  EXPECT_TRUE(map.emplace("two", MoveOnly(2)).second);
+  std::string key = "three";
+  EXPECT_TRUE(map.try_emplace(std::move(key), 3).second);
+  EXPECT_TRUE(key.empty());
+  std::string again = "one";
+  EXPECT_FALSE(map.try_emplace(std::move(again), 5).second);
+  EXPECT_EQ(again, "one"); // ключ не забирается, если узел не создан
+  EXPECT_FALSE(map.emplace(std::string("two"), MoveOnly(7)).second);
+  EXPECT_EQ(map.at("two").value, 2);
+  EXPECT_TRUE(map.emplace(std::piecewise_construct, std::forward_as_tuple("a"),
+                          std::forward_as_tuple(4))
+                  .second);
+  EXPECT_EQ(map.size(), 4);
+  EXPECT_EQ(map.begin()->second.value, 4);
+}
+
+TEST(MapTest, insert_or_assign_moves_value) {
+  s21::Map<int, std::string> map;
+  std::string value = "first";
+  EXPECT_TRUE(map.insert_or_assign(1, std::move(value)).second);
+  EXPECT_TRUE(value.empty());
+  std::string update = "second";
+  auto [it, inserted] = map.insert_or_assign(1, std::move(update));
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(it->second, "second");
+  EXPECT_TRUE(update.empty());
+  EXPECT_TRUE(map.insert_or_assign(2, "literal").second);
+  EXPECT_EQ(map[2], "literal");
+}
+
+TEST(MapTest, from_sorted_builds_valid_tree) {
+  std::list<std::pair<int, int>> items;
+  for (int n = 0; n <= 300; ++n) {
+    auto map = s21::Map<int, int>::from_sorted(items.begin(), items.end());
+    ASSERT_EQ(map.size(), static_cast<size_t>(n));
+    ASSERT_GT(rb_black_height(map.root_), 0) << n;
+    int expected = 0;
+    for (auto &item : map)
+      ASSERT_EQ(item.first, expected++);
+    map.insert({-1, 0}); // после сборки дерево остаётся обычным Map
+    map.erase(map.find(n / 2));
+    ASSERT_GT(rb_black_height(map.root_), 0) << n;
+    items.push_back({n, n * 2});
+  }
+}
+
+TEST(MapTest, sorted_range_skips_duplicates) {
+  std::pair<int, std::string> items[] = {
+      {1, "a"}, {1, "b"}, {2, "c"}, {3, "d"}, {3, "e"}, {3, "f"}};
+  s21::Map<int, std::string> map(s21::assume_sorted, std::begin(items),
+                                 std::end(items));
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at(1), "a");
+  EXPECT_EQ(map.at(3), "d");
+  std::map<int, int> source = {{1, 1}, {2, 2}, {3, 3}};
+  s21::Map<int, int, std::greater<int>> reversed(
+      s21::assume_sorted, source.rbegin(), source.rend());
+  int expected = 3;
+  for (auto &item : reversed)
+    EXPECT_EQ(item.first, expected--);
+  EXPECT_EQ(expected, 0);
+}
+
+TEST(MapTest, copy_clones_shape) {
+  s21::Map<int, std::string> map;
+  for (int i = 0; i < 1000; ++i)
+    map.insert({(i * 7919) % 1000, std::to_string(i)});
+  s21::Map<int, std::string> copy(map);
+  ASSERT_EQ(copy.size(), map.size());
+  ASSERT_GT(rb_black_height(copy.root_), 0);
+  EXPECT_EQ(copy.root_->data.first, map.root_->data.first);
+  EXPECT_EQ(copy.root_->left->data.first, map.root_->left->data.first);
+  auto it = map.begin();
+  for (auto &item : copy) {
+    EXPECT_EQ(item, *it);
+    ++it;
+  }
+  copy.at(5) = "changed";
+  EXPECT_NE(map.at(5), "changed");
+  s21::Map<int, std::string> assigned = {{-1, "x"}};
+  assigned = copy;
+  EXPECT_EQ(assigned.size(), 1000);
+  EXPECT_EQ(assigned.at(5), "changed");
+  EXPECT_FALSE(assigned.contains(-1));
+}
+
+TEST(MapTest, extract_and_reinsert_node) {
+  s21::Map<int, MoveOnly> map;
+  for (int i = 0; i < 10; ++i)
+    map.try_emplace(i, i * 10);
+  MoveOnly *address = &map.at(4);
+  auto handle = map.extract(4);
+  ASSERT_FALSE(handle.empty());
+  EXPECT_EQ(handle.key(), 4);
+  EXPECT_EQ(handle.mapped().value, 40);
+  EXPECT_EQ(map.size(), 9);
+  EXPECT_FALSE(map.contains(4));
+  ASSERT_GT(rb_black_height(map.root_), 0);
+  EXPECT_TRUE(map.extract(100).empty());
+
+  s21::Map<int, MoveOnly> other;
+  auto result = other.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(handle.empty());
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(&result.position->second, address); // тот же узел, без копии
+  auto again = other.insert(map.extract(map.begin()));
+  EXPECT_TRUE(again.inserted);
+  other.try_emplace(5, 0);
+  auto duplicate = other.insert(map.extract(5));
+  EXPECT_FALSE(duplicate.inserted);
+  ASSERT_FALSE(duplicate.node.empty()); // узел возвращается вызывающему
+  EXPECT_EQ(duplicate.node.mapped().value, 50);
+  EXPECT_EQ(duplicate.position->first, 5);
+  EXPECT_FALSE(other.insert(s21::Map<int, MoveOnly>::node_type()).inserted);
+}
+
+TEST(MapTest, merge_relinks_and_keeps_duplicates) {
+  s21::Map<int, std::string> target = {{1, "a"}, {3, "c"}};
+  s21::Map<int, std::string> source;
+  for (int i = 0; i < 200; ++i)
+    source.insert({i, "s" + std::to_string(i)});
+  std::string *moved = &source.at(100);
+  target.merge(source);
+  EXPECT_EQ(target.size(), 200);
+  EXPECT_EQ(source.size(), 2);
+  EXPECT_EQ(source.at(1), "s1");
+  EXPECT_EQ(source.at(3), "s3");
+  EXPECT_EQ(target.at(1), "a");
+  EXPECT_EQ(&target.at(100), moved);
+  ASSERT_GT(rb_black_height(target.root_), 0);
+  ASSERT_GT(rb_black_height(source.root_), 0);
+  target.merge(target);
+  EXPECT_EQ(target.size(), 200);
+}
+
+TEST(MapTest, lower_upper_bound_and_equal_range) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 100; i += 10)
+    map.insert({i, i});
+  EXPECT_EQ(map.lower_bound(30)->first, 30);
+  EXPECT_EQ(map.lower_bound(31)->first, 40);
+  EXPECT_EQ(map.upper_bound(30)->first, 40);
+  EXPECT_EQ(map.lower_bound(-5), map.begin());
+  EXPECT_EQ(map.lower_bound(91), map.end());
+  EXPECT_EQ(map.upper_bound(90), map.end());
+  auto [first, last] = map.equal_range(50);
+  EXPECT_EQ(first->first, 50);
+  EXPECT_EQ(last->first, 60);
+  auto missing = map.equal_range(55);
+  EXPECT_EQ(missing.first, missing.second);
+  EXPECT_EQ(missing.first->first, 60);
+  int sum = 0; // окно [25, 65)
+  for (auto it = map.lower_bound(25); it != map.lower_bound(65); ++it)
+    sum += it->first;
+  EXPECT_EQ(sum, 30 + 40 + 50 + 60);
+
+  s21::Map<std::string, int, std::less<>> names = {{"ann", 1}, {"bob", 2}};
+  EXPECT_EQ(names.lower_bound(std::string_view("b"))->first, "bob");
+  EXPECT_EQ(names.upper_bound("bob"), names.end());
+  EXPECT_EQ(names.equal_range("ann").first->second, 1);
+}
+
+TEST(MapTest, erase_range_and_key) {
+  std::map<int, int> expected;
+  s21::Map<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map.insert({i, i});
+    expected.insert({i, i});
+  }
+  EXPECT_EQ(map.erase(5), 1);
+  EXPECT_EQ(map.erase(5), 0);
+  expected.erase(5);
+  auto next = map.erase(map.lower_bound(100), map.lower_bound(200));
+  expected.erase(expected.lower_bound(100), expected.lower_bound(200));
+  EXPECT_EQ(next->first, 200);
+  ASSERT_GT(rb_black_height(map.root_), 0);
+  next = map.erase(map.lower_bound(250), map.lower_bound(900));
+  expected.erase(expected.lower_bound(250), expected.lower_bound(900));
+  EXPECT_EQ(next->first, 900);
+  ASSERT_GT(rb_black_height(map.root_), 0);
+  ASSERT_EQ(map.size(), expected.size());
+  auto it = expected.begin();
+  for (auto &item : map)
+    EXPECT_EQ(item.first, (it++)->first);
+  EXPECT_EQ(map.erase(map.begin(), map.begin()), map.begin());
+  map.erase(map.lower_bound(901), map.end());
+  EXPECT_EQ(map.upper_bound(900), map.end());
+  EXPECT_EQ(map.erase(map.begin(), map.end()), map.end());
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.root_, nullptr);
+}
+
+// размеры поддеревьев сходятся с фактическим числом узлов
+template <typename Node> bool subtree_sizes_ok(const Node *node) {
+  if (!node)
+    return true;
+  size_t left = node->left ? node->left->size : 0;
+  size_t right = node->right ? node->right->size : 0;
+  return node->size == left + right + 1 && subtree_sizes_ok(node->left) &&
+         subtree_sizes_ok(node->right);
+}
+
+TEST(MapTest, select_and_rank) {
+  s21::Map<int, int> map;
+  EXPECT_EQ(map.select(0), map.end());
+  EXPECT_EQ(map.rank(5), 0);
+  for (int i = 0; i < 100; ++i)
+    map.insert({i * 3, i});
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(map.select(i)->first, i * 3);
+    ASSERT_EQ(map.rank(i * 3), static_cast<size_t>(i));
+    ASSERT_EQ(map.rank(i * 3 + 1), static_cast<size_t>(i + 1));
+  }
+  EXPECT_EQ(map.select(100), map.end());
+  EXPECT_EQ(map.rank(-1), 0);
+  EXPECT_EQ(map.count_range(10, 31), 7); // 12, 15, ..., 30
+  EXPECT_EQ(map.count_range(30, 30), 0);
+  EXPECT_EQ(map.count_range(50, 10), 0);
+  EXPECT_EQ(map.count_range(-100, 1000), 100);
+
+  s21::Map<std::string, int, std::less<>> names = {
+      {"ann", 1}, {"bob", 2}, {"eve", 3}};
+  EXPECT_EQ(names.rank(std::string_view("c")), 2);
+  EXPECT_EQ(names.select(1)->first, "bob");
+}
+
+TEST(MapTest, subtree_sizes_survive_updates) {
+  s21::Map<int, int> map;
+  std::map<int, int> expected;
+  unsigned seed = 11;
+  for (int i = 0; i < 5000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    int key = static_cast<int>(seed >> 16) % 700;
+    if (seed & 0x100) {
+      map.try_emplace(key, i);
+      expected.emplace(key, i);
+    } else {
+      map.erase(key);
+      expected.erase(key);
+    }
+  }
+  ASSERT_TRUE(subtree_sizes_ok(map.root_));
+  ASSERT_EQ(map.size(), expected.size());
+  size_t index = 0;
+  for (auto &item : expected)
+    ASSERT_EQ(map.select(index++)->first, item.first);
+
+  s21::Map<int, int> other;
+  for (int i = 0; i < 1000; i += 7)
+    other.insert({i, i});
+  map.merge(other);
+  auto node = map.extract(map.select(10));
+  other.insert(std::move(node));
+  map.erase(map.lower_bound(100), map.lower_bound(300));
+  s21::Map<int, int> copy(map);
+  auto built = s21::Map<int, int>::from_sorted(expected.begin(),
+                                               expected.end());
+  for (const auto *tree : {&map, &other, &copy, &built})
+    EXPECT_TRUE(subtree_sizes_ok(tree->root_));
+  int last_key = 0;
+  for (auto &item : map)
+    last_key = item.first;
+  EXPECT_EQ(copy.select(copy.size() - 1)->first, last_key);
+  EXPECT_EQ(built.rank(expected.rbegin()->first), expected.size() - 1);
+}
+
+TEST(MapTest, range_erase_keeps_subtree_sizes) {
+  unsigned seed = 29;
+  for (int round = 0; round < 200; ++round) {
+    s21::Map<int, int> map;
+    std::map<int, int> expected;
+    for (int i = 0; i < 300; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      int key = static_cast<int>(seed >> 16) % 1000;
+      map.try_emplace(key, i);
+      expected.emplace(key, i);
+    }
+    while (!expected.empty()) {
+      seed = seed * 1103515245u + 12345u;
+      int low = static_cast<int>(seed >> 16) % 1000;
+      int high = low + static_cast<int>(seed >> 8) % 200;
+      map.erase(map.lower_bound(low), map.lower_bound(high));
+      expected.erase(expected.lower_bound(low), expected.lower_bound(high));
+      ASSERT_TRUE(subtree_sizes_ok(map.root_));
+      ASSERT_GT(rb_black_height(map.root_), 0);
+      ASSERT_EQ(map.size(), expected.size());
+      if (!expected.empty()) {
+        ASSERT_EQ(map.select(expected.size() / 2)->first,
+                  std::next(expected.begin(), expected.size() / 2)->first);
+      }
+    }
+  }
+}
+
+TEST(MapTest, find_batch_matches_find) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 60000; i += 3) // больше порога пакетного поиска
+    map.insert({i, -i});
+  s21::vector<int> keys(1000);
+  unsigned seed = 5;
+  for (int i = 0; i < 1000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    keys[i] = static_cast<int>(seed >> 8) % 60100 - 50;
+  }
+  s21::vector<s21::Map<int, int>::iterator> found(1000);
+  bool present[1000];
+  map.find_batch(keys.begin(), keys.end(), found.begin());
+  map.contains_batch(keys.begin(), keys.end(), present);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(found[i], map.find(keys[i]));
+    ASSERT_EQ(present[i], map.contains(keys[i]));
+  }
+
+  s21::Map<int, int> empty;
+  present[0] = true;
+  empty.contains_batch(keys.begin(), keys.begin() + 3, present);
+  EXPECT_FALSE(present[0] || present[1] || present[2]);
+}
+
+TEST(MapTest, find_batch_writes_through_output_iterator) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 60000; i += 3)
+    map.insert({i, -i});
+  std::list<int> keys;
+  for (int i = 0; i < 1001; ++i) // не кратно ширине пакета
+    keys.push_back((i * 7919) % 60100 - 50);
+  std::list<s21::Map<int, int>::iterator> found;
+  std::list<bool> present;
+  map.find_batch(keys.begin(), keys.end(), std::back_inserter(found));
+  map.contains_batch(keys.begin(), keys.end(), std::back_inserter(present));
+  ASSERT_EQ(found.size(), keys.size());
+  ASSERT_EQ(present.size(), keys.size());
+  auto it = found.begin();
+  auto has = present.begin();
+  for (int key : keys) {
+    ASSERT_EQ(*it++, map.find(key));
+    ASSERT_EQ(*has++, map.contains(key));
+  }
+}
+
 // s21_vector ----------------------------------------------------------------
 TEST(Vector, DataMethod) {
   s21::vector<int> vec{10, 20, 30, 40, 50};
@@ -1430,6 +3767,58 @@ TEST(Vector, Modifier_Swap) {
   EXPECT_EQ(s21_vector_2.size(), s21_vector_3.size());
 }
 
+TEST(Vector, Modifier_RemoveIf) {
+  s21::vector<std::string> s21_vector = {"a", "bb", "c", "dd", "ee", "f"};
+  size_t capacity = s21_vector.capacity();
+  EXPECT_EQ(s21_vector.remove_if(
+                [](const std::string &s) { return s.size() == 2; }),
+            3);
+  std::vector<std::string> std_vector = {"a", "c", "f"};
+  EXPECT_EQ(s21_vector.size(), std_vector.size());
+  EXPECT_EQ(s21_vector.capacity(), capacity);
+  for (size_t i = 0; i < std_vector.size(); ++i)
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  auto none = [](const std::string &) { return false; };
+  EXPECT_EQ(s21::erase_if(s21_vector, none), 0);
+  EXPECT_EQ(s21_vector.size(), 3);
+}
+
+TEST(Vector, Modifier_RemoveIf_ReleasesTail) {
+  auto shared = std::make_shared<int>(1);
+  s21::vector<std::shared_ptr<int>> s21_vector = {shared, nullptr, shared,
+                                                  nullptr, shared};
+  EXPECT_EQ(shared.use_count(), 4);
+  EXPECT_EQ(s21_vector.remove_if(
+                [](const std::shared_ptr<int> &p) { return p != nullptr; }),
+            3);
+  EXPECT_EQ(shared.use_count(), 1);
+  EXPECT_EQ(s21_vector.size(), 2);
+}
+
+TEST(Vector, Modifier_Truncate) {
+  auto shared = std::make_shared<int>(1);
+  s21::vector<std::shared_ptr<int>> s21_vector = {shared, shared, shared};
+  s21_vector.truncate(1);
+  EXPECT_EQ(s21_vector.size(), 1);
+  EXPECT_EQ(shared.use_count(), 2);
+  EXPECT_THROW(s21_vector.truncate(2), std::length_error);
+  s21_vector.truncate(0);
+  EXPECT_TRUE(s21_vector.empty());
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(Vector, Modifier_Remove) {
+  s21::vector<int> s21_vector = {7, 1, 7, 2, 7, 7, 3};
+  EXPECT_EQ(s21_vector.remove(s21_vector[0]), 4);
+  EXPECT_EQ(s21_vector.size(), 3);
+  EXPECT_EQ(s21_vector.front(), 1);
+  EXPECT_EQ(s21_vector.back(), 3);
+  EXPECT_EQ(s21_vector.remove(42), 0);
+  s21::vector<int> empty;
+  EXPECT_EQ(empty.remove(1), 0);
+  EXPECT_EQ(s21::erase_if(empty, [](int) { return true; }), 0);
+}
+
 TEST(Vector, Throw) {
   s21::vector<int> v;
   EXPECT_THROW(v.front(), std::logic_error);